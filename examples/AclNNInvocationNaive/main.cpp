@@ -184,8 +184,19 @@ int main(int argc, char **argv)
     // 3. 调用CANN自定义算子库API
     uint64_t workspaceSize = 0;
     aclOpExecutor *executor;
+    // 精度模式，可选"high_precision"（默认）或"high_performance"
+    char precisionMode[] = "high_precision";
+    // 输入绝对值上界，0.0表示无上界
+    double maxAbsInput = 0.0;
+    // 输出数据类型（ge::DataType枚举值），-1表示与输入一致
+    int64_t dstType = -1;
+    // y = alpha * cos(beta * x + gamma)，取1.0、1.0、0.0时即cos(x)
+    double alpha = 1.0;
+    double beta = 1.0;
+    double gamma = 0.0;
     // 计算workspace大小并申请内存
-    ret = aclnnCosGetWorkspaceSize(inputX, outputY, &workspaceSize, &executor);
+    ret = aclnnCosGetWorkspaceSize(inputX, precisionMode, maxAbsInput, dstType, alpha, beta, gamma, outputY,
+                                   &workspaceSize, &executor);
     CHECK_RET(ret == ACL_SUCCESS, LOG_PRINT("aclnnCosGetWorkspaceSize failed. ERROR: %d\n", ret); return FAILED);
     void *workspaceAddr = nullptr;
     if (workspaceSize > 0) {
@@ -0,0 +1,33 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * @file aclnn_inplace_cos.cpp
+ */
+#include "aclnn_inplace_cos.h"
+#include "aclnn_cos.h"
+
+// The generated aclnnCos with selfRef as both x and out. Every Cos kernel reads a tile before it writes the
+// same range of y and the core slices are disjoint, so x == y needs no extra buffer; a strided selfRef is
+// read in place and the generated interface copies the dense y back into the view.
+extern "C" aclnnStatus aclnnInplaceCosGetWorkspaceSize(aclTensor* selfRef, char* precisionModeOptional,
+                                                       double maxAbsInputOptional, uint64_t* workspaceSize,
+                                                       aclOpExecutor** executor)
+{
+    // dst_type -1: y keeps the type of selfRef; alpha 1, beta 1, gamma 0: plain cos
+    return aclnnCosGetWorkspaceSize(selfRef, precisionModeOptional, maxAbsInputOptional, -1, 1.0, 1.0, 0.0, selfRef,
+                                    workspaceSize, executor);
+}
+
+extern "C" aclnnStatus aclnnInplaceCos(void* workspace, uint64_t workspaceSize, aclOpExecutor* executor,
+                                       aclrtStream stream)
+{
+    return aclnnCos(workspace, workspaceSize, executor, stream);
+}
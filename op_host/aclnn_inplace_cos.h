@@ -0,0 +1,38 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * @file aclnn_inplace_cos.h
+ */
+#ifndef ACLNN_INPLACE_COS_H
+#define ACLNN_INPLACE_COS_H
+#include "aclnn/acl_meta.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * selfRef = cos(selfRef). Same attributes and workspace contract as aclnnCosGetWorkspaceSize, without a
+ * separate out tensor.
+ */
+__attribute__((visibility("default")))
+aclnnStatus aclnnInplaceCosGetWorkspaceSize(aclTensor* selfRef, char* precisionModeOptional,
+                                            double maxAbsInputOptional, uint64_t* workspaceSize,
+                                            aclOpExecutor** executor);
+
+__attribute__((visibility("default")))
+aclnnStatus aclnnInplaceCos(void* workspace, uint64_t workspaceSize, aclOpExecutor* executor,
+                            aclrtStream stream);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // ACLNN_INPLACE_COS_H
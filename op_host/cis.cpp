@@ -0,0 +1,91 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * @file cis.cpp
+ */
+#include "cis_tiling.h"
+#include "cos_tiling_common.h"
+#include "register/op_def_registry.h"
+#include "graph/utils/type_utils.h"
+#include "tiling/platform/platform_ascendc.h"
+
+namespace optiling {
+static ge::graphStatus TilingFunc(gert::TilingContext* context)
+{
+    CosTilingData tiling;
+    uint64_t ubSize;
+    auto ascendcPlatform = platform_ascendc::PlatformAscendC(context->GetPlatformInfo());
+    ascendcPlatform.GetCoreMemSize(platform_ascendc::CoreMemType::UB, ubSize);
+    auto coreNum = ascendcPlatform.GetCoreNum();
+    auto xType = context->GetInputDesc(0)->GetDataType();
+
+    uint64_t inputNum = context->GetInputShape(0)->GetStorageShape().GetShapeSize();
+    uint32_t xTypeLength = (xType == ge::DT_FLOAT) ? 4 : 2;
+
+    // slices and tiles count elements of x; every one of them writes a complex64 pair to y
+    CosSplitInfo info = CosCisSplit(inputNum, xTypeLength, ubSize, coreNum);
+
+    tiling.set_bigCoreDataNum(info.bigCoreDataNum);
+    tiling.set_smallCoreDataNum(info.smallCoreDataNum);
+    tiling.set_tailCoreDataNum(info.tailCoreDataNum);
+    tiling.set_tileDataNum(info.tileDataNum);
+    tiling.set_bigCoreNum(info.bigCoreNum);
+
+    context->SetBlockDim(info.coreNum);
+    tiling.SaveToBuffer(context->GetRawTilingData()->GetData(), context->GetRawTilingData()->GetCapacity());
+    context->GetRawTilingData()->SetDataSize(tiling.GetDataSize());
+    size_t *currentWorkspace = context->GetWorkspaceSizes(1);
+    currentWorkspace[0] = 0;
+    return ge::GRAPH_SUCCESS;
+}
+}
+
+
+namespace ge {
+static ge::graphStatus InferShape(gert::InferShapeContext* context)
+{
+    const gert::Shape* x1_shape = context->GetInputShape(0);
+    gert::Shape* y_shape = context->GetOutputShape(0);
+    *y_shape = *x1_shape;
+    return GRAPH_SUCCESS;
+}
+static ge::graphStatus InferDataType(gert::InferDataTypeContext *context)
+{
+    context->SetOutputDataType(0, ge::DT_COMPLEX64);
+    return ge::GRAPH_SUCCESS;
+}
+}
+
+
+namespace ops {
+class Cis : public OpDef {
+public:
+    explicit Cis(const char* name) : OpDef(name)
+    {
+        this->Input("x")
+            .ParamType(REQUIRED)
+            .DataType({ge::DT_FLOAT16, ge::DT_FLOAT, ge::DT_BF16})
+            .Format({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND});
+        this->Output("y")
+            .ParamType(REQUIRED)
+            .DataType({ge::DT_COMPLEX64, ge::DT_COMPLEX64, ge::DT_COMPLEX64})
+            .Format({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND});
+
+        this->SetInferShape(ge::InferShape).SetInferDataType(ge::InferDataType);
+
+        this->AICore()
+            .SetTiling(optiling::TilingFunc)
+            .AddConfig("ascend910b");
+    }
+};
+
+OP_ADD(Cis);
+}
@@ -12,14 +12,42 @@
  * @file cos.cpp
  */
 #include "cos_tiling.h"
+#include "cos_debug_switch.h"
+#include "cos_tiling_common.h"
+#include "cos_tuned_tiling.h"
 #include "register/op_def_registry.h"
 #include "graph/utils/type_utils.h"
 #include "tiling/platform/platform_ascendc.h"
 #include <algorithm>
-#include <cmath>
+#include <cstring>
+#include <string>
+#include <vector>
 
 namespace optiling {
-constexpr uint32_t BLOCK_SIZE = 32;
+/**
+ * Reads the view of x that aclnn passes without a contiguous copy (IgnoreContiguous). Tensors without
+ * strides are contiguous and leave view.dimNum at 0.
+ */
+static bool GetInputView(gert::TilingContext* context, CosViewInfo& view)
+{
+    view.dimNum = 0;
+    const gert::Stride* stride = context->GetInputStride(0);
+    if (stride == nullptr || stride->GetDimNum() == 0) {
+        return true;
+    }
+    const gert::Shape& shape = context->GetInputShape(0)->GetStorageShape();
+    if (shape.GetDimNum() != stride->GetDimNum()) {
+        return false;
+    }
+    // any rank: only the dims left after collapsing are bounded by COS_VIEW_MAX_DIM
+    std::vector<int64_t> viewShape(shape.GetDimNum());
+    std::vector<int64_t> viewStride(shape.GetDimNum());
+    for (size_t i = 0; i < shape.GetDimNum(); i++) {
+        viewShape[i] = shape.GetDim(i);
+        viewStride[i] = stride->GetStride(i);
+    }
+    return CosCollapseView(viewShape.data(), viewStride.data(), static_cast<uint32_t>(viewShape.size()), view);
+}
 
 static ge::graphStatus TilingFunc(gert::TilingContext* context)
 {
@@ -30,42 +58,187 @@ static ge::graphStatus TilingFunc(gert::TilingContext* context)
     auto coreNum = ascendcPlatform.GetCoreNum();
     auto socVersion = ascendcPlatform.GetSocVersion();
     auto xType = context->GetInputDesc(0)->GetDataType();
+    auto yType = context->GetOutputDesc(0)->GetDataType();
 
-    if (socVersion != platform_ascendc::SocVersion::ASCEND910B && xType == ge::DT_BF16) {
+    if (socVersion != platform_ascendc::SocVersion::ASCEND910B && (xType == ge::DT_BF16 || yType == ge::DT_BF16)) {
         return ge::GRAPH_FAILED;
     }
 
-    uint32_t inputNum = context->GetInputShape(0)->GetStorageShape().GetShapeSize();
+    uint64_t inputNum = context->GetInputShape(0)->GetStorageShape().GetShapeSize();
     uint32_t xTypeLength = (xType == ge::DT_FLOAT) ? 4 : 2;
-    uint32_t blockElemNum = BLOCK_SIZE / xTypeLength;
+    // dst_type: the kernel casts its float result straight to y's type; the split counts elements in
+    // blocks of the narrower type so that both x and y slices start on 32-byte blocks
+    uint32_t yTypeLength = (yType == ge::DT_FLOAT) ? 4 : 2;
+    uint32_t splitTypeLength = std::min(xTypeLength, yTypeLength);
+    bool castOut = (xType != yType);
 
-    uint32_t inputBlockNum = (inputNum / blockElemNum) + (inputNum % blockElemNum != 0);
-    coreNum = std::max(std::min(coreNum, (uint32_t)std::sqrt(0.375f * inputBlockNum)), 1u);
-    uint32_t smallCoreBlockNum = inputBlockNum / coreNum;
-    uint32_t bigCoreNum = inputBlockNum % coreNum;
+    uint64_t tilingKey;
+    const char* precisionMode = context->GetAttrs()->GetStr(0);
+    if (precisionMode == nullptr || strcmp(precisionMode, "high_precision") == 0) {
+        tilingKey = COS_TILING_KEY_HIGH_PRECISION;
+    } else if (strcmp(precisionMode, "high_performance") == 0) {
+        tilingKey = COS_TILING_KEY_HIGH_PERFORMANCE;
+    } else {
+        return ge::GRAPH_FAILED;
+    }
+    // y = alpha * cos(beta * x + gamma); the table and fp16 kernels only compute cos(x)
+    const float* alpha = context->GetAttrs()->GetFloat(3);
+    const float* beta = context->GetAttrs()->GetFloat(4);
+    const float* gamma = context->GetAttrs()->GetFloat(5);
+    tiling.set_alpha(alpha != nullptr ? *alpha : 1.0f);
+    tiling.set_beta(beta != nullptr ? *beta : 1.0f);
+    tiling.set_gamma(gamma != nullptr ? *gamma : 0.0f);
+    bool affine = CosIsAffine(tiling.get_alpha(), tiling.get_beta(), tiling.get_gamma());
+    const float* maxAbsInput = context->GetAttrs()->GetFloat(1);
+    if (maxAbsInput != nullptr) {
+        // max_abs_input bounds x, the strategy sees beta * x + gamma
+        tilingKey = CosRangeTilingKey(tilingKey, CosAffineMaxAbs(*maxAbsInput, tiling.get_beta(), tiling.get_gamma()));
+    }
+    if (CosFeatureDisabled(CosFeature::FUSED_STRATEGY)) {
+        if (tilingKey == COS_TILING_KEY_HIGH_PRECISION) {
+            tilingKey = COS_TILING_KEY_HIGH_PRECISION_UNFUSED;
+        } else if (tilingKey == COS_TILING_KEY_HIGH_PERFORMANCE) {
+            tilingKey = COS_TILING_KEY_HIGH_PERFORMANCE_UNFUSED;
+        }
+    }
 
-    uint32_t smallCoreDataNum = smallCoreBlockNum * blockElemNum;
-    uint32_t bigCoreDataNum = smallCoreDataNum + blockElemNum;
+    bool refOnly = (socVersion == platform_ascendc::SocVersion::ASCEND310P);
+    CosViewInfo view;
+    if (!GetInputView(context, view)) {
+        return ge::GRAPH_FAILED;
+    }
+    if (view.dimNum != 0) {
+        // strided x: KernelCosView reads the rows in place, without the static, tuned, LUT or half variants
+        uint32_t rowTileLen = 0;
+        CosSplitInfo info = CosViewSplit(view, xTypeLength, yTypeLength, CosStrategyTmpBufNum(tilingKey, refOnly),
+                                         ubSize, coreNum, rowTileLen);
+        context->SetTilingKey(tilingKey + COS_TILING_KEY_VIEW_STEP);
+        tiling.set_bigCoreDataNum(info.bigCoreDataNum);
+        tiling.set_smallCoreDataNum(info.smallCoreDataNum);
+        tiling.set_tailCoreDataNum(info.tailCoreDataNum);
+        tiling.set_tileDataNum(info.tileDataNum);
+        tiling.set_bigCoreNum(info.bigCoreNum);
+        tiling.set_rowLen(view.rowLen);
+        tiling.set_rowTileLen(rowTileLen);
+        tiling.set_viewDimNum(view.dimNum);
+        tiling.set_viewShape(view.shape);
+        tiling.set_viewStride(view.stride);
+        context->SetBlockDim(info.coreNum);
+        tiling.SaveToBuffer(context->GetRawTilingData()->GetData(), context->GetRawTilingData()->GetCapacity());
+        context->GetRawTilingData()->SetDataSize(tiling.GetDataSize());
+        context->GetWorkspaceSizes(1)[0] = 0;
+        return ge::GRAPH_SUCCESS;
+    }
 
-    uint32_t ubTileNum;
-    if (socVersion == platform_ascendc::SocVersion::ASCEND310P) {
-        ubTileNum = (xType == ge::DT_FLOAT) ? 6 : 12;
-    } else {
-        ubTileNum = (xType == ge::DT_FLOAT) ? 8 : 16;
+    if (socVersion == platform_ascendc::SocVersion::ASCEND910B && !CosFeatureDisabled(CosFeature::HALF_STRATEGY)) {
+        tilingKey = CosHalfTilingKey(tilingKey, xType == ge::DT_FLOAT16 && yType == ge::DT_FLOAT16 && !affine);
     }
-    uint32_t tileBlockNum = (ubSize / BLOCK_SIZE) / ubTileNum;
-    uint32_t tileDataNum = tileBlockNum * blockElemNum;
 
-    tiling.set_bigCoreDataNum(bigCoreDataNum);
-    tiling.set_smallCoreDataNum(smallCoreDataNum);
-    tiling.set_tileDataNum(tileDataNum);
-    tiling.set_bigCoreNum(bigCoreNum);
+    // x and y queues plus the temporaries of the strategy the key dispatches to
+    uint32_t tmpBufNum = CosStrategyTmpBufNum(tilingKey, refOnly);
+    uint32_t vecInstrNum = CosStrategyVecInstrNum(tilingKey, refOnly);
+    uint32_t ubTileNum = CosUbTileNumCast(xTypeLength, yTypeLength, tmpBufNum);
+    CosSplitInfo info = CosCommonSplit(inputNum, splitTypeLength, ubSize, coreNum, ubTileNum,
+                                       {vecInstrNum, 2, COS_BUFFER_NUM});
 
-    context->SetBlockDim(coreNum);
+    // the table holds the results of the strategy it replaces; the fp16 kernel picks its strategy per tile
+    if (socVersion == platform_ascendc::SocVersion::ASCEND910B && xTypeLength != sizeof(float) && !castOut && !affine &&
+        tilingKey != COS_TILING_KEY_HALF && !CosFeatureDisabled(CosFeature::LUT)) {
+        CosSplitInfo lutInfo = CosLutSplit(inputNum, xTypeLength, ubSize, coreNum, tilingKey);
+        if (CosEstimateLut(lutInfo, xTypeLength, tilingKey) <
+            CosEstimateSplit(info, xTypeLength, {vecInstrNum, 2, COS_BUFFER_NUM})) {
+            tilingKey = CosLutTilingKey(tilingKey);
+            info = lutInfo;
+        }
+    }
+
+    uint64_t modeKey = tilingKey;
+    uint32_t staticBucket = 0;
+    // the static buckets, queue depths and tuned entries are sized for y of x's type
+    bool staticCapable = !castOut &&
+                         (tilingKey == COS_TILING_KEY_HIGH_PRECISION || tilingKey == COS_TILING_KEY_HIGH_PERFORMANCE);
+    if (staticCapable && !CosFeatureDisabled(CosFeature::STATIC_TILING)) {
+        staticBucket = CosStaticBucket(inputNum, coreNum, info);
+    }
+    if (staticBucket != 0) {
+        uint32_t staticCoreDataNum = COS_STATIC_CORE_DATA_NUM[staticBucket - 1];
+        info.coreNum = inputNum / staticCoreDataNum;
+        info.bigCoreDataNum = staticCoreDataNum;
+        info.smallCoreDataNum = staticCoreDataNum;
+        info.tailCoreDataNum = staticCoreDataNum;
+        info.tileDataNum = COS_STATIC_TILE_DATA_NUM;
+        info.bigCoreNum = 0;
+        tilingKey += COS_TILING_KEY_STATIC_STEP * staticBucket;
+    } else if (staticCapable) {
+        // queue depth and tile length are chosen together; the static buckets stay double buffered
+        uint32_t bufferNum = CosSelectBufferNum(inputNum, xTypeLength, ubSize, coreNum, 2, tmpBufNum, vecInstrNum);
+        if (bufferNum != COS_BUFFER_NUM) {
+            ubTileNum = CosUbTileNum(xTypeLength, 2, tmpBufNum, bufferNum);
+            info = CosCommonSplit(inputNum, xTypeLength, ubSize, coreNum, ubTileNum, {vecInstrNum, 2, bufferNum});
+            tilingKey += COS_TILING_KEY_BUFFER_STEP * bufferNum;
+        }
+    }
+
+    if (staticCapable && !CosFeatureDisabled(CosFeature::TUNED_TILING)) {
+        uint32_t tunedSoc = (socVersion == platform_ascendc::SocVersion::ASCEND910B) ? COS_TUNED_SOC_ASCEND910B :
+                            refOnly ? COS_TUNED_SOC_ASCEND310P : 0;
+        const CosTunedTiling* tuned = CosFindTunedTiling(COS_TUNED_TILING.data(), COS_TUNED_TILING.size(), tunedSoc,
+                                                         xTypeLength, modeKey, inputNum);
+        if (tuned != nullptr) {
+            uint32_t tunedTileNum = CosUbTileNum(xTypeLength, 2, CosStrategyTmpBufNum(tuned->tilingKey, refOnly));
+            // entries that do not fit this launch keep the heuristic split
+            if (CosTunedSplit(*tuned, inputNum, ubSize, coreNum, tunedTileNum, info)) {
+                tilingKey = tuned->tilingKey;
+            }
+        }
+    }
+    context->SetTilingKey(tilingKey);
+
+    tiling.set_bigCoreDataNum(info.bigCoreDataNum);
+    tiling.set_smallCoreDataNum(info.smallCoreDataNum);
+    tiling.set_tailCoreDataNum(info.tailCoreDataNum);
+    tiling.set_tileDataNum(info.tileDataNum);
+    tiling.set_bigCoreNum(info.bigCoreNum);
+
+    context->SetBlockDim(info.coreNum);
     tiling.SaveToBuffer(context->GetRawTilingData()->GetData(), context->GetRawTilingData()->GetCapacity());
     context->GetRawTilingData()->SetDataSize(tiling.GetDataSize());
     size_t *currentWorkspace = context->GetWorkspaceSizes(1);
-    currentWorkspace[0] = 0;
+    // the LUT kernel builds its table in the workspace and synchronises all cores with SyncAll
+    currentWorkspace[0] = (tilingKey % COS_TILING_KEY_STATIC_STEP == COS_TILING_KEY_LUT) ?
+        ascendcPlatform.GetLibApiWorkSpaceSize() + CosLutTableBytes(xTypeLength) : 0;
+    return ge::GRAPH_SUCCESS;
+}
+
+/**
+ * Graph compile check: tensors of at most COS_AICPU_MAX_DATA_NUM elements are reported unsupported so that
+ * the engine falls back to the AICPU kernel of opp_kernel_aicpu, which runs HighPrecStrategy or
+ * HighPerfStrategy on the CPU without the launch cost of an AI core kernel. Only where it gives the bits of
+ * the AI core keys: not on Atlas inference products, whose AI core runs RefStrategy, nor with a
+ * max_abs_input hint, which moves AI core to keys 3 and 4.
+ */
+static ge::graphStatus CheckSupported(const ge::Operator& op, ge::AscendString& result)
+{
+    int64_t inputNum = op.GetInputDescByName("x").GetShape().GetShapeSize();
+    // the AICPU kernel writes y in x's type, dst_type stays on AI core
+    bool sameType = (op.GetInputDescByName("x").GetDataType() == op.GetOutputDescByName("y").GetDataType());
+    // and computes cos(x) only, alpha, beta and gamma stay on AI core as well
+    float alpha = 1.0f;
+    float beta = 1.0f;
+    float gamma = 0.0f;
+    op.GetAttr("alpha", alpha);
+    op.GetAttr("beta", beta);
+    op.GetAttr("gamma", gamma);
+    float maxAbsInput = 0.0f;
+    op.GetAttr("max_abs_input", maxAbsInput);
+    bool refOnly = (platform_ascendc::PlatformAscendCManager::GetInstance()->GetSocVersion() ==
+                    platform_ascendc::SocVersion::ASCEND310P);
+    bool preferAicpu = sameType && !CosIsAffine(alpha, beta, gamma) && !refOnly && !(maxAbsInput > 0.0f) &&
+                       !CosFeatureDisabled(CosFeature::AICPU) && CosPreferAicpu(inputNum);
+    std::string resultJson = preferAicpu ?
+        R"({"ret_code": "0", "reason": "tiny input runs faster on the AICPU Cos kernel"})" :
+        R"({"ret_code": "1", "reason": ""})";
+    result = ge::AscendString(resultJson.c_str());
     return ge::GRAPH_SUCCESS;
 }
 }
@@ -82,7 +255,17 @@ static ge::graphStatus InferShape(gert::InferShapeContext* context)
 static ge::graphStatus InferDataType(gert::InferDataTypeContext *context)
 {
     const auto inputDataType = context->GetInputDataType(0);
-    context->SetOutputDataType(0, inputDataType);
+    // dst_type < 0 keeps the input type, otherwise y takes that ge::DataType
+    const int64_t* dstType = context->GetAttrs()->GetInt(2);
+    if (dstType == nullptr || *dstType < 0) {
+        context->SetOutputDataType(0, inputDataType);
+        return ge::GRAPH_SUCCESS;
+    }
+    auto outputDataType = static_cast<ge::DataType>(*dstType);
+    if (outputDataType != ge::DT_FLOAT16 && outputDataType != ge::DT_FLOAT && outputDataType != ge::DT_BF16) {
+        return ge::GRAPH_FAILED;
+    }
+    context->SetOutputDataType(0, outputDataType);
     return ge::GRAPH_SUCCESS;
 }
 }
@@ -93,30 +276,48 @@ class Cos : public OpDef {
 public:
     explicit Cos(const char* name) : OpDef(name)
     {
+        // every pairing of x and y types, y following dst_type; strided views of x reach TilingFunc as they are
+        // instead of through a contiguous copy
         this->Input("x")
             .ParamType(REQUIRED)
-            .DataType({ge::DT_FLOAT16, ge::DT_FLOAT, ge::DT_BF16})
-            .Format({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND});
+            .DataType({ge::DT_FLOAT16, ge::DT_FLOAT16, ge::DT_FLOAT16, ge::DT_FLOAT, ge::DT_FLOAT, ge::DT_FLOAT,
+                       ge::DT_BF16, ge::DT_BF16, ge::DT_BF16})
+            .Format({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND,
+                     ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND})
+            .IgnoreContiguous();
         this->Output("y")
             .ParamType(REQUIRED)
-            .DataType({ge::DT_FLOAT16, ge::DT_FLOAT, ge::DT_BF16})
-            .Format({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND});
+            .DataType({ge::DT_FLOAT16, ge::DT_FLOAT, ge::DT_BF16, ge::DT_FLOAT16, ge::DT_FLOAT, ge::DT_BF16,
+                       ge::DT_FLOAT16, ge::DT_FLOAT, ge::DT_BF16})
+            .Format({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND,
+                     ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND});
+        this->Attr("precision_mode").AttrType(OPTIONAL).String("high_precision");
+        this->Attr("max_abs_input").AttrType(OPTIONAL).Float(0.0);
+        this->Attr("dst_type").AttrType(OPTIONAL).Int(-1);
+        this->Attr("alpha").AttrType(OPTIONAL).Float(1.0);
+        this->Attr("beta").AttrType(OPTIONAL).Float(1.0);
+        this->Attr("gamma").AttrType(OPTIONAL).Float(0.0);
 
         this->SetInferShape(ge::InferShape).SetInferDataType(ge::InferDataType);
 
+        OpAICoreConfig config910b;
+        config910b.NeedCheckSupportFlag(true);
         this->AICore()
             .SetTiling(optiling::TilingFunc)
-            .AddConfig("ascend910b");
+            .SetCheckSupport(optiling::CheckSupported)
+            .AddConfig("ascend910b", config910b);
 
         OpAICoreConfig config310p;
+        config310p.NeedCheckSupportFlag(true);
         config310p.Input("x")
                   .ParamType(REQUIRED)
-                  .DataType({ge::DT_FLOAT16, ge::DT_FLOAT})
-                  .Format({ge::FORMAT_ND, ge::FORMAT_ND});
+                  .DataType({ge::DT_FLOAT16, ge::DT_FLOAT16, ge::DT_FLOAT, ge::DT_FLOAT})
+                  .Format({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND})
+                  .IgnoreContiguous();
         config310p.Output("y")
                   .ParamType(REQUIRED)
-                  .DataType({ge::DT_FLOAT16, ge::DT_FLOAT})
-                  .Format({ge::FORMAT_ND, ge::FORMAT_ND});
+                  .DataType({ge::DT_FLOAT16, ge::DT_FLOAT, ge::DT_FLOAT16, ge::DT_FLOAT})
+                  .Format({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND});
         this->AICore()
             .AddConfig("ascend310p", config310p);
     }
@@ -0,0 +1,60 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * @file cos_debug_switch.h
+ * The one place the Cos tiling reads the environment. COS_DISABLE lists, comma separated, the features to
+ * turn off for a run, e.g. to time both paths of a shape with msprof:
+ *   COS_DISABLE=static_tiling,fused_strategy msprof op --output=./prof ./execute_cos_op
+ * Unknown names are ignored, an unset or empty variable keeps every feature.
+ */
+#ifndef COS_DEBUG_SWITCH_H
+#define COS_DEBUG_SWITCH_H
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+namespace optiling {
+enum class CosFeature : uint32_t {
+    FUSED_STRATEGY,  // fused keys 1 and 2, replaced by the unfused keys 5 and 6
+    HALF_STRATEGY,   // fp16 high_performance in half precision, key 8
+    LUT,             // 16-bit table kernel, keys 17 to 67
+    STATIC_TILING,   // static shape buckets of keys 1 and 2
+    TUNED_TILING,    // entries of op_host/cos_tuned_tiling.h
+    AICPU,           // CheckSupported routing tiny inputs to the AICPU kernel
+};
+
+// names in COS_DISABLE, in CosFeature order
+constexpr const char* COS_FEATURE_NAMES[] = {
+    "fused_strategy", "half_strategy", "lut", "static_tiling", "tuned_tiling", "aicpu",
+};
+
+/**
+ * Returns whether feature is listed in COS_DISABLE.
+ */
+inline bool CosFeatureDisabled(CosFeature feature)
+{
+    const char* list = std::getenv("COS_DISABLE");
+    if (list == nullptr) {
+        return false;
+    }
+    const char* name = COS_FEATURE_NAMES[static_cast<uint32_t>(feature)];
+    size_t nameLen = strlen(name);
+    for (const char* item = list; *item != '\0';) {
+        size_t itemLen = strcspn(item, ",");
+        if (itemLen == nameLen && strncmp(item, name, nameLen) == 0) {
+            return true;
+        }
+        item += (item[itemLen] == ',') ? itemLen + 1 : itemLen;
+    }
+    return false;
+}
+} // namespace optiling
+#endif // COS_DEBUG_SWITCH_H
@@ -0,0 +1,115 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * @file cos_grad.cpp
+ */
+#include "cos_grad_tiling.h"
+#include "cos_tiling_common.h"
+#include "register/op_def_registry.h"
+#include "graph/utils/type_utils.h"
+#include "tiling/platform/platform_ascendc.h"
+
+namespace optiling {
+static ge::graphStatus TilingFunc(gert::TilingContext* context)
+{
+    CosTilingData tiling;
+    uint64_t ubSize;
+    auto ascendcPlatform = platform_ascendc::PlatformAscendC(context->GetPlatformInfo());
+    ascendcPlatform.GetCoreMemSize(platform_ascendc::CoreMemType::UB, ubSize);
+    auto coreNum = ascendcPlatform.GetCoreNum();
+    auto xType = context->GetInputDesc(0)->GetDataType();
+
+    uint64_t inputNum = context->GetInputShape(0)->GetStorageShape().GetShapeSize();
+    uint32_t xTypeLength = (xType == ge::DT_FLOAT) ? 4 : 2;
+    if (context->GetInputShape(1)->GetStorageShape().GetShapeSize() != static_cast<int64_t>(inputNum)) {
+        return ge::GRAPH_FAILED;
+    }
+
+    // dy, x (or sin_x) and dx queues; recomputing sin(x) adds the HighPrecFusedStrategy temporaries and the
+    // float tile ComputeSinImpl writes sin(x) to
+    const gert::StorageShape* sinShape = context->GetOptionalInputShape(2);
+    bool savedSin = (sinShape != nullptr);
+    if (savedSin && sinShape->GetStorageShape().GetShapeSize() != static_cast<int64_t>(inputNum)) {
+        return ge::GRAPH_FAILED;
+    }
+    uint32_t tmpBufNum = savedSin ? 0 : COS_TMP_BUF_NUM_HIGH_PREC + 1;
+    uint32_t vecInstrNum = savedSin ? COS_VEC_INSTR_NUM_GRAD : COS_VEC_INSTR_NUM_SIN + COS_VEC_INSTR_NUM_GRAD;
+    uint32_t ubTileNum = CosUbTileNum(xTypeLength, 3, tmpBufNum);
+    CosSplitInfo info = CosCommonSplit(inputNum, xTypeLength, ubSize, coreNum, ubTileNum,
+                                       {vecInstrNum, 3, COS_BUFFER_NUM});
+    context->SetTilingKey(savedSin ? COS_GRAD_TILING_KEY_SAVED_SIN : COS_GRAD_TILING_KEY_RECOMPUTE);
+
+    tiling.set_bigCoreDataNum(info.bigCoreDataNum);
+    tiling.set_smallCoreDataNum(info.smallCoreDataNum);
+    tiling.set_tailCoreDataNum(info.tailCoreDataNum);
+    tiling.set_tileDataNum(info.tileDataNum);
+    tiling.set_bigCoreNum(info.bigCoreNum);
+
+    context->SetBlockDim(info.coreNum);
+    tiling.SaveToBuffer(context->GetRawTilingData()->GetData(), context->GetRawTilingData()->GetCapacity());
+    context->GetRawTilingData()->SetDataSize(tiling.GetDataSize());
+    size_t *currentWorkspace = context->GetWorkspaceSizes(1);
+    currentWorkspace[0] = 0;
+    return ge::GRAPH_SUCCESS;
+}
+}
+
+
+namespace ge {
+static ge::graphStatus InferShape(gert::InferShapeContext* context)
+{
+    const gert::Shape* x1_shape = context->GetInputShape(0);
+    gert::Shape* dx_shape = context->GetOutputShape(0);
+    *dx_shape = *x1_shape;
+    return GRAPH_SUCCESS;
+}
+static ge::graphStatus InferDataType(gert::InferDataTypeContext *context)
+{
+    const auto inputDataType = context->GetInputDataType(0);
+    context->SetOutputDataType(0, inputDataType);
+    return ge::GRAPH_SUCCESS;
+}
+}
+
+
+namespace ops {
+class CosGrad : public OpDef {
+public:
+    explicit CosGrad(const char* name) : OpDef(name)
+    {
+        this->Input("dy")
+            .ParamType(REQUIRED)
+            .DataType({ge::DT_FLOAT16, ge::DT_FLOAT, ge::DT_BF16})
+            .Format({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND});
+        this->Input("x")
+            .ParamType(REQUIRED)
+            .DataType({ge::DT_FLOAT16, ge::DT_FLOAT, ge::DT_BF16})
+            .Format({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND});
+        // sin(x) saved by the forward pass, e.g. the y_sin of SinCos; x is not read when it is given
+        this->Input("sin_x")
+            .ParamType(OPTIONAL)
+            .DataType({ge::DT_FLOAT16, ge::DT_FLOAT, ge::DT_BF16})
+            .Format({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND});
+        this->Output("dx")
+            .ParamType(REQUIRED)
+            .DataType({ge::DT_FLOAT16, ge::DT_FLOAT, ge::DT_BF16})
+            .Format({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND});
+
+        this->SetInferShape(ge::InferShape).SetInferDataType(ge::InferDataType);
+
+        this->AICore()
+            .SetTiling(optiling::TilingFunc)
+            .AddConfig("ascend910b");
+    }
+};
+
+OP_ADD(CosGrad);
+}
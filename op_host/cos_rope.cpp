@@ -0,0 +1,126 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * @file cos_rope.cpp
+ */
+#include "cos_rope_tiling.h"
+#include "cos_tiling_common.h"
+#include "register/op_def_registry.h"
+#include "graph/utils/type_utils.h"
+#include "tiling/platform/platform_ascendc.h"
+
+namespace optiling {
+static ge::graphStatus TilingFunc(gert::TilingContext* context)
+{
+    CosRopeTilingData tiling;
+    uint64_t ubSize;
+    auto ascendcPlatform = platform_ascendc::PlatformAscendC(context->GetPlatformInfo());
+    ascendcPlatform.GetCoreMemSize(platform_ascendc::CoreMemType::UB, ubSize);
+    auto coreNum = ascendcPlatform.GetCoreNum();
+    auto xType = context->GetInputDesc(0)->GetDataType();
+    uint32_t xTypeLength = (xType == ge::DT_FLOAT) ? 4 : 2;
+    // positions are int32 or float, 4 bytes either way
+    uint32_t posTypeLength = 4;
+
+    // x is [..., headDim], its rows are the heads of the tokens in positions, token-major
+    const gert::Shape& xShape = context->GetInputShape(0)->GetStorageShape();
+    if (xShape.GetDimNum() == 0) {
+        return ge::GRAPH_FAILED;
+    }
+    int64_t headDim = xShape.GetDim(xShape.GetDimNum() - 1);
+    if (headDim <= 0 || headDim % COS_ROPE_DIM_ALIGN != 0 || headDim > COS_ROPE_MAX_HEAD_DIM) {
+        return ge::GRAPH_FAILED;
+    }
+    if (context->GetInputShape(2)->GetStorageShape().GetShapeSize() != headDim / 2) {
+        return ge::GRAPH_FAILED;
+    }
+    uint64_t rowNum = xShape.GetShapeSize() / headDim;
+    uint64_t tokenNum = context->GetInputShape(1)->GetStorageShape().GetShapeSize();
+    uint64_t headNum = (tokenNum == 0) ? 1 : rowNum / tokenNum;
+    if (headNum == 0 || headNum > UINT32_MAX || tokenNum * headNum != rowNum) {
+        return ge::GRAPH_FAILED;
+    }
+
+    uint32_t tokenTileNum = 0;
+    CosSplitInfo info = CosRopeSplit(tokenNum, static_cast<uint32_t>(headNum), static_cast<uint32_t>(headDim),
+                                     xTypeLength, posTypeLength, ubSize, coreNum, tokenTileNum);
+    if (info.tileDataNum == 0) {
+        return ge::GRAPH_FAILED;
+    }
+
+    tiling.set_bigCoreDataNum(info.bigCoreDataNum);
+    tiling.set_smallCoreDataNum(info.smallCoreDataNum);
+    tiling.set_tailCoreDataNum(info.tailCoreDataNum);
+    tiling.set_tileDataNum(info.tileDataNum);
+    tiling.set_bigCoreNum(info.bigCoreNum);
+    tiling.set_headNum(static_cast<uint32_t>(headNum));
+    tiling.set_headDim(static_cast<uint32_t>(headDim));
+    tiling.set_tokenTileNum(tokenTileNum);
+
+    context->SetBlockDim(info.coreNum);
+    tiling.SaveToBuffer(context->GetRawTilingData()->GetData(), context->GetRawTilingData()->GetCapacity());
+    context->GetRawTilingData()->SetDataSize(tiling.GetDataSize());
+    size_t *currentWorkspace = context->GetWorkspaceSizes(1);
+    currentWorkspace[0] = 0;
+    return ge::GRAPH_SUCCESS;
+}
+}
+
+
+namespace ge {
+static ge::graphStatus InferShape(gert::InferShapeContext* context)
+{
+    const gert::Shape* x1_shape = context->GetInputShape(0);
+    gert::Shape* y_shape = context->GetOutputShape(0);
+    *y_shape = *x1_shape;
+    return GRAPH_SUCCESS;
+}
+static ge::graphStatus InferDataType(gert::InferDataTypeContext *context)
+{
+    const auto inputDataType = context->GetInputDataType(0);
+    context->SetOutputDataType(0, inputDataType);
+    return ge::GRAPH_SUCCESS;
+}
+}
+
+
+namespace ops {
+class CosRope : public OpDef {
+public:
+    explicit CosRope(const char* name) : OpDef(name)
+    {
+        this->Input("x")
+            .ParamType(REQUIRED)
+            .DataType({ge::DT_FLOAT16, ge::DT_FLOAT, ge::DT_BF16, ge::DT_FLOAT16, ge::DT_FLOAT, ge::DT_BF16})
+            .Format({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND});
+        this->Input("positions")
+            .ParamType(REQUIRED)
+            .DataType({ge::DT_INT32, ge::DT_INT32, ge::DT_INT32, ge::DT_FLOAT, ge::DT_FLOAT, ge::DT_FLOAT})
+            .Format({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND});
+        this->Input("inv_freq")
+            .ParamType(REQUIRED)
+            .DataType({ge::DT_FLOAT, ge::DT_FLOAT, ge::DT_FLOAT, ge::DT_FLOAT, ge::DT_FLOAT, ge::DT_FLOAT})
+            .Format({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND});
+        this->Output("y")
+            .ParamType(REQUIRED)
+            .DataType({ge::DT_FLOAT16, ge::DT_FLOAT, ge::DT_BF16, ge::DT_FLOAT16, ge::DT_FLOAT, ge::DT_BF16})
+            .Format({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND});
+
+        this->SetInferShape(ge::InferShape).SetInferDataType(ge::InferDataType);
+
+        this->AICore()
+            .SetTiling(optiling::TilingFunc)
+            .AddConfig("ascend910b");
+    }
+};
+
+OP_ADD(CosRope);
+}
@@ -0,0 +1,33 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * @file cos_rope_tiling.h
+ */
+#ifndef COS_ROPE_TILING_H
+#define COS_ROPE_TILING_H
+#include "register/tilingdata_base.h"
+
+namespace optiling {
+BEGIN_TILING_DATA_DEF(CosRopeTilingData)
+  // core slices and tiles count rows, one head of one token each (CosRopeSplit)
+  TILING_DATA_FIELD_DEF(uint64_t, bigCoreDataNum);
+  TILING_DATA_FIELD_DEF(uint64_t, smallCoreDataNum);
+  TILING_DATA_FIELD_DEF(uint64_t, tailCoreDataNum);
+  TILING_DATA_FIELD_DEF(uint32_t, tileDataNum);
+  TILING_DATA_FIELD_DEF(uint32_t, bigCoreNum);
+  TILING_DATA_FIELD_DEF(uint32_t, headNum);
+  TILING_DATA_FIELD_DEF(uint32_t, headDim);
+  TILING_DATA_FIELD_DEF(uint32_t, tokenTileNum);
+END_TILING_DATA_DEF;
+
+REGISTER_TILING_DATA_CLASS(CosRope, CosRopeTilingData)
+} // namespace optiling
+#endif // COS_ROPE_TILING_H
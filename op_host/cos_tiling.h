@@ -17,10 +17,21 @@
 
 namespace optiling {
 BEGIN_TILING_DATA_DEF(CosTilingData)
-  TILING_DATA_FIELD_DEF(uint32_t, bigCoreDataNum);
-  TILING_DATA_FIELD_DEF(uint32_t, smallCoreDataNum);
+  TILING_DATA_FIELD_DEF(uint64_t, bigCoreDataNum);
+  TILING_DATA_FIELD_DEF(uint64_t, smallCoreDataNum);
+  TILING_DATA_FIELD_DEF(uint64_t, tailCoreDataNum);
   TILING_DATA_FIELD_DEF(uint32_t, tileDataNum);
   TILING_DATA_FIELD_DEF(uint32_t, bigCoreNum);
+  // y = alpha * cos(beta * x + gamma), applied by KernelCos and KernelCosView around the strategy
+  TILING_DATA_FIELD_DEF(float, alpha);
+  TILING_DATA_FIELD_DEF(float, beta);
+  TILING_DATA_FIELD_DEF(float, gamma);
+  // KernelCosView only: the collapsed view of x (CosViewInfo) and the row chunk length
+  TILING_DATA_FIELD_DEF(uint64_t, rowLen);
+  TILING_DATA_FIELD_DEF(uint32_t, rowTileLen);
+  TILING_DATA_FIELD_DEF(uint32_t, viewDimNum);
+  TILING_DATA_FIELD_DEF_ARR(uint64_t, 8, viewShape);
+  TILING_DATA_FIELD_DEF_ARR(uint64_t, 8, viewStride);
 END_TILING_DATA_DEF;
 
 REGISTER_TILING_DATA_CLASS(Cos, CosTilingData)
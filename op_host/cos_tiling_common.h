@@ -0,0 +1,765 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * @file cos_tiling_common.h
+ */
+#ifndef COS_TILING_COMMON_H
+#define COS_TILING_COMMON_H
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace optiling {
+constexpr uint32_t BLOCK_SIZE = 32;
+
+// tiling keys dispatched by TILING_KEY_IS in op_kernel/cos.cpp:
+// key = strategy + COS_TILING_KEY_STATIC_STEP * static shape bucket (0 = generic split)
+constexpr uint64_t COS_TILING_KEY_HIGH_PRECISION = 1;
+constexpr uint64_t COS_TILING_KEY_HIGH_PERFORMANCE = 2;
+constexpr uint64_t COS_TILING_KEY_HIGH_PRECISION_SHORT = 3;
+constexpr uint64_t COS_TILING_KEY_NO_REDUCTION = 4;
+// keys 1 and 2 run the Axpy-fused reductions; these run the original Muls + Sub sequences
+constexpr uint64_t COS_TILING_KEY_HIGH_PRECISION_UNFUSED = 5;
+constexpr uint64_t COS_TILING_KEY_HIGH_PERFORMANCE_UNFUSED = 6;
+// 16-bit inputs gathered from a table built with the strategy of the key it replaces, carried in the tens
+// digit (CosLutTilingKey), so the results are bit-identical to that key
+constexpr uint64_t COS_TILING_KEY_LUT = 7;
+// fp16 high_performance computed in half precision, tiles beyond COS_HALF_MAX_ABS run key 2's strategy
+constexpr uint64_t COS_TILING_KEY_HALF = 8;
+constexpr uint64_t COS_TILING_KEY_STATIC_STEP = 10;
+// the hundreds digit carries the queue depth of keys 1 and 2 on the generic split, 0 = COS_BUFFER_NUM
+constexpr uint64_t COS_TILING_KEY_BUFFER_STEP = 100;
+// strategies 1 to 6 reading a strided view of x in place, KernelCosView
+constexpr uint64_t COS_TILING_KEY_VIEW_STEP = 1000;
+
+// max_abs_input bounds under which the cheaper kernels keep the accuracy of HighPrecStrategy
+constexpr float COS_SHORT_REDUCE_MAX_ABS = 8192.0f;
+constexpr float COS_NO_REDUCE_MAX_ABS = 0.785398163f;
+// largest tile max |x| HalfStrategy handles, HALF_MAX_ABS in op_kernel/cos_strategy.h
+constexpr float COS_HALF_MAX_ABS = 64.0f;
+
+// static shape buckets: every core processes exactly COS_STATIC_CORE_DATA_NUM[bucket - 1] elements in
+// tiles of COS_STATIC_TILE_DATA_NUM, both compiled into the kernel as template constants
+constexpr uint32_t COS_STATIC_TILE_DATA_NUM = 4096;
+constexpr uint32_t COS_STATIC_CORE_DATA_NUM[] = {2048, 4096, 6144, 8192, 16384, 32768, 65536};
+constexpr uint32_t COS_STATIC_BUCKET_NUM = sizeof(COS_STATIC_CORE_DATA_NUM) / sizeof(COS_STATIC_CORE_DATA_NUM[0]);
+
+/**
+ * Narrows the precision_mode key using the caller's max_abs_input hint (0 = unbounded). Inputs within
+ * pi / 4 skip range reduction altogether; high precision inputs within COS_SHORT_REDUCE_MAX_ABS only
+ * need a single Cody-Waite stage. The hint is trusted: larger inputs lose accuracy, they are not checked.
+ */
+inline uint64_t CosRangeTilingKey(uint64_t modeKey, float maxAbsInput)
+{
+    if (!(maxAbsInput > 0.0f)) {
+        return modeKey;
+    }
+    if (maxAbsInput <= COS_NO_REDUCE_MAX_ABS) {
+        return COS_TILING_KEY_NO_REDUCTION;
+    }
+    if (modeKey == COS_TILING_KEY_HIGH_PRECISION && maxAbsInput <= COS_SHORT_REDUCE_MAX_ABS) {
+        return COS_TILING_KEY_HIGH_PRECISION_SHORT;
+    }
+    return modeKey;
+}
+
+/**
+ * Returns whether the alpha, beta and gamma attributes of Cos change y = alpha * cos(beta * x + gamma) from cos(x).
+ */
+inline bool CosIsAffine(float alpha, float beta, float gamma)
+{
+    return alpha != 1.0f || beta != 1.0f || gamma != 0.0f;
+}
+
+/**
+ * Returns the bound of |beta * x + gamma| for |x| <= maxAbsInput, keeping 0 (unbounded) as it is.
+ */
+inline float CosAffineMaxAbs(float maxAbsInput, float beta, float gamma)
+{
+    if (!(maxAbsInput > 0.0f)) {
+        return maxAbsInput;
+    }
+    return std::fabs(beta) * maxAbsInput + std::fabs(gamma);
+}
+
+/**
+ * Moves fp16 high_performance inputs to the half precision kernel. Its accuracy (below 2 fp16 ULP) only
+ * meets the high_performance contract, so high_precision keeps widening to fp32.
+ */
+inline uint64_t CosHalfTilingKey(uint64_t tilingKey, bool float16)
+{
+    return (float16 && tilingKey == COS_TILING_KEY_HIGH_PERFORMANCE) ? COS_TILING_KEY_HALF : tilingKey;
+}
+
+// default copies of every input/output queue, BUFFER_NUM in op_kernel/sin_cos.cpp and the generic
+// depth of op_kernel/cos.cpp
+constexpr uint32_t COS_BUFFER_NUM = 2;
+// depths TilingFunc may pick for Cos instead: a single buffer when every core fits into one tile, three
+// buffers for 16-bit streams long enough to keep the MTE2/MTE3 pipeline busy
+constexpr uint32_t COS_SINGLE_BUFFER_NUM = 1;
+constexpr uint32_t COS_TRIPLE_BUFFER_NUM = 3;
+constexpr uint64_t COS_TRIPLE_BUFFER_MIN_TILE_NUM = 4;
+
+// float scratch tiles of each kernel strategy, TMP_BUF_NUM in op_kernel/cos_strategy.h; the strategies
+// alias their intermediates onto the fewest buffers their liveness allows
+constexpr uint32_t COS_TMP_BUF_NUM_REF = 1;
+constexpr uint32_t COS_TMP_BUF_NUM_HIGH_PERF = 3;
+constexpr uint32_t COS_TMP_BUF_NUM_HIGH_PERF_FUSED = 2;
+constexpr uint32_t COS_TMP_BUF_NUM_HIGH_PREC = 3;
+constexpr uint32_t COS_TMP_BUF_NUM_NO_REDUCE = 0;
+// counted in half tiles: HalfStrategy scratch, allocated next to that of the fp32 fallback
+constexpr uint32_t COS_TMP_BUF_NUM_HALF = 2;
+
+/**
+ * Returns the scratch tile count of the strategy the kernel dispatches for tilingKey. refOnly is set
+ * on SoCs whose kernel maps every key to RefStrategy (Atlas inference, __CCE_AICORE__ == 200).
+ */
+inline uint32_t CosStrategyTmpBufNum(uint64_t tilingKey, bool refOnly)
+{
+    if (refOnly) {
+        return COS_TMP_BUF_NUM_REF;
+    }
+    switch (tilingKey % COS_TILING_KEY_STATIC_STEP) {
+        case COS_TILING_KEY_HIGH_PERFORMANCE:
+            return COS_TMP_BUF_NUM_HIGH_PERF_FUSED;
+        case COS_TILING_KEY_HIGH_PERFORMANCE_UNFUSED:
+            return COS_TMP_BUF_NUM_HIGH_PERF;
+        case COS_TILING_KEY_NO_REDUCTION:
+            return COS_TMP_BUF_NUM_NO_REDUCE;
+        case COS_TILING_KEY_HALF:
+            return COS_TMP_BUF_NUM_HIGH_PERF_FUSED + COS_TMP_BUF_NUM_HALF / 2;
+        case COS_TILING_KEY_LUT:
+            // KernelCosLut builds its table in tiles of the table strategy
+            return CosStrategyTmpBufNum(tilingKey / COS_TILING_KEY_STATIC_STEP % COS_TILING_KEY_STATIC_STEP, false);
+        default:
+            return COS_TMP_BUF_NUM_HIGH_PREC;
+    }
+}
+
+// vector instructions per tile of each strategy's ComputeImpl (ComputeSinCosImpl for SinCos, ComputeSinImpl
+// for CosGrad), counted from op_kernel/cos_strategy.h; the cost model below scales them by the tile length
+constexpr uint32_t COS_VEC_INSTR_NUM_REF = 27;
+constexpr uint32_t COS_VEC_INSTR_NUM_HIGH_PERF = 44;
+constexpr uint32_t COS_VEC_INSTR_NUM_HIGH_PERF_FUSED = 35;
+constexpr uint32_t COS_VEC_INSTR_NUM_HIGH_PREC = 98;
+constexpr uint32_t COS_VEC_INSTR_NUM_HIGH_PREC_FUSED = 71;
+constexpr uint32_t COS_VEC_INSTR_NUM_HIGH_PREC_SHORT = 42;
+constexpr uint32_t COS_VEC_INSTR_NUM_NO_REDUCE = 9;
+constexpr uint32_t COS_VEC_INSTR_NUM_SIN_COS = 86;
+constexpr uint32_t COS_VEC_INSTR_NUM_SIN = 71;
+// KernelCosLut: Cast, Adds, Cast and ShiftLeft make the Gather offsets; Gather reads UB element by element
+// and is charged like 8 contiguous vector instructions
+constexpr uint32_t COS_VEC_INSTR_NUM_LUT = 4 + 8;
+// HalfStrategy in half instructions, each repeat covering twice the elements of an fp32 one
+constexpr uint32_t COS_VEC_INSTR_NUM_HALF = 22;
+// KernelCosHalf in fp32 instructions: HalfStrategy plus Abs and ReduceMax at half the repeats, less the
+// two casts the cost model adds for 16-bit inputs, which the half path skips
+constexpr uint32_t COS_VEC_INSTR_NUM_HALF_FP32 = (COS_VEC_INSTR_NUM_HALF + 2) / 2 - 2;
+
+/**
+ * Returns the vector instruction count per tile of the strategy the kernel dispatches for tilingKey,
+ * with refOnly as in CosStrategyTmpBufNum.
+ */
+inline uint32_t CosStrategyVecInstrNum(uint64_t tilingKey, bool refOnly)
+{
+    if (refOnly) {
+        return COS_VEC_INSTR_NUM_REF;
+    }
+    switch (tilingKey % COS_TILING_KEY_STATIC_STEP) {
+        case COS_TILING_KEY_HIGH_PERFORMANCE:
+            return COS_VEC_INSTR_NUM_HIGH_PERF_FUSED;
+        case COS_TILING_KEY_HIGH_PERFORMANCE_UNFUSED:
+            return COS_VEC_INSTR_NUM_HIGH_PERF;
+        case COS_TILING_KEY_HIGH_PRECISION_SHORT:
+            return COS_VEC_INSTR_NUM_HIGH_PREC_SHORT;
+        case COS_TILING_KEY_NO_REDUCTION:
+            return COS_VEC_INSTR_NUM_NO_REDUCE;
+        case COS_TILING_KEY_HIGH_PRECISION_UNFUSED:
+            return COS_VEC_INSTR_NUM_HIGH_PREC;
+        case COS_TILING_KEY_LUT:
+            return COS_VEC_INSTR_NUM_LUT;
+        case COS_TILING_KEY_HALF:
+            return COS_VEC_INSTR_NUM_HALF_FP32;
+        default:
+            return COS_VEC_INSTR_NUM_HIGH_PREC_FUSED;
+    }
+}
+
+/**
+ * Returns how many tiles, counted in elements of the input type, one tileDataNum occupies in UB:
+ * bufferNum copies of each of the queueNum input/output queues, one float buffer per queue on the
+ * 16-bit cast path, and tmpBufNum float temporaries.
+ */
+inline uint32_t CosUbTileNum(uint32_t xTypeLength, uint32_t queueNum, uint32_t tmpBufNum,
+                             uint32_t bufferNum = COS_BUFFER_NUM)
+{
+    uint32_t floatTileNum = sizeof(float) / xTypeLength;
+    uint32_t castBufNum = (xTypeLength == sizeof(float)) ? 0 : queueNum;
+    return queueNum * bufferNum + (castBufNum + tmpBufNum) * floatTileNum;
+}
+
+/**
+ * CosUbTileNum for a y of yTypeLength bytes (dst_type), counted in tiles of the narrower of both types, which
+ * the caller then splits by: each queue holds its own type and each 16-bit side adds one float buffer.
+ * Equals CosUbTileNum when both types match.
+ */
+inline uint32_t CosUbTileNumCast(uint32_t xTypeLength, uint32_t yTypeLength, uint32_t tmpBufNum,
+                                 uint32_t bufferNum = COS_BUFFER_NUM)
+{
+    uint32_t splitTypeLength = std::min(xTypeLength, yTypeLength);
+    uint32_t castBufNum = (xTypeLength == sizeof(float) ? 0 : 1) + (yTypeLength == sizeof(float) ? 0 : 1);
+    uint32_t tileBytes = bufferNum * (xTypeLength + yTypeLength) + (castBufNum + tmpBufNum) * sizeof(float);
+    return (tileBytes + splitTypeLength - 1) / splitTypeLength;
+}
+
+struct CosSplitInfo {
+    uint32_t coreNum;
+    uint64_t bigCoreDataNum;
+    uint64_t smallCoreDataNum;
+    uint64_t tailCoreDataNum;
+    uint32_t tileDataNum;
+    uint32_t bigCoreNum;
+    // granularity of the core slices: one 32-byte block or one GM burst, in elements
+    uint32_t alignDataNum;
+};
+
+// the work one tile of the kernel does besides its length: what the cost model charges a core for
+struct CosCostInfo {
+    uint32_t vecInstrNum;
+    uint32_t queueNum;
+    uint32_t bufferNum;
+};
+
+// cost model of one launch in AI core cycles. The figures are coarse 910B estimates; the split only
+// depends on how they compare, not on their absolute values
+constexpr uint32_t COS_GM_BURST_SIZE = 512;
+constexpr uint64_t COS_COST_LAUNCH_PER_CORE = 8;    // block dispatch
+constexpr uint64_t COS_COST_CORE_SETUP = 1200;      // tiling load, InitBuffer and SetGlobalBuffer
+constexpr uint64_t COS_COST_TILE_OVERHEAD = 120;    // queue synchronisation and scalar bookkeeping
+constexpr uint64_t COS_COST_VEC_ISSUE = 12;         // issue latency of one vector instruction
+constexpr uint64_t COS_COST_VEC_REPEAT_BYTES = 256; // float bytes one vector repeat handles per cycle
+constexpr uint64_t COS_COST_DMA_SETUP = 250;        // latency of one MTE2/MTE3 instruction
+constexpr uint64_t COS_COST_CORE_GM_BYTES = 128;    // GM bytes per cycle a single core can stream
+constexpr uint64_t COS_COST_TOTAL_GM_BYTES = 1024;  // GM bytes per cycle shared by all active cores
+
+struct CosTileCycles {
+    uint64_t vec;
+    uint64_t dma;
+};
+
+/**
+ * Estimates the vector and MTE cycles of one tile of dataNum elements. Vector time is the issue
+ * latency plus one cycle per 256-byte repeat of every instruction (16-bit inputs add a Cast per
+ * queue). Each queue moves the tile in 512-byte bursts over the GM bandwidth left to one of
+ * activeCoreNum cores; a tile that does not start on a burst boundary pays one extra burst.
+ */
+inline CosTileCycles CosEstimateTile(uint64_t dataNum, uint32_t xTypeLength, bool burstAligned,
+                                     uint32_t activeCoreNum, const CosCostInfo& cost)
+{
+    uint64_t instrNum = cost.vecInstrNum + ((xTypeLength == sizeof(float)) ? 0 : cost.queueNum);
+    uint64_t repeatNum = (dataNum * sizeof(float) + COS_COST_VEC_REPEAT_BYTES - 1) / COS_COST_VEC_REPEAT_BYTES;
+    uint64_t burstNum = (dataNum * xTypeLength + COS_GM_BURST_SIZE - 1) / COS_GM_BURST_SIZE;
+    burstNum += burstAligned ? 0 : 1;
+    // a core streams at most COS_COST_CORE_GM_BYTES per cycle; past that many cores they share the total
+    uint64_t shareNum = std::max<uint64_t>(COS_COST_TOTAL_GM_BYTES / COS_COST_CORE_GM_BYTES, activeCoreNum);
+    uint64_t burstCycles = burstNum * COS_GM_BURST_SIZE * shareNum / COS_COST_TOTAL_GM_BYTES;
+    CosTileCycles cycles;
+    cycles.vec = instrNum * (COS_COST_VEC_ISSUE + repeatNum);
+    cycles.dma = cost.queueNum * (COS_COST_DMA_SETUP + burstCycles);
+    return cycles;
+}
+
+/**
+ * Estimates the cycles of one core processing dataNum elements in tiles of tileDataNum. With two or
+ * more buffers copies overlap compute, so a tile costs the slower of both and the pipeline fill adds
+ * one tile of copies; a single buffer serialises them.
+ */
+inline uint64_t CosEstimateCore(uint64_t dataNum, uint32_t xTypeLength, uint32_t tileDataNum, bool burstAligned,
+                                uint32_t activeCoreNum, const CosCostInfo& cost)
+{
+    uint64_t cycles = COS_COST_CORE_SETUP;
+    if (dataNum == 0) {
+        return cycles;
+    }
+    bool tileAligned = burstAligned && (static_cast<uint64_t>(tileDataNum) * xTypeLength % COS_GM_BURST_SIZE == 0);
+    uint64_t fullTileNum = dataNum / tileDataNum;
+    uint64_t tailDataNum = dataNum % tileDataNum;
+    CosTileCycles full = CosEstimateTile(tileDataNum, xTypeLength, tileAligned, activeCoreNum, cost);
+    CosTileCycles tail = CosEstimateTile(tailDataNum, xTypeLength, tileAligned, activeCoreNum, cost);
+    CosTileCycles first = (fullTileNum != 0) ? full : tail;
+    if (cost.bufferNum > 1) {
+        cycles += fullTileNum * (std::max(full.vec, full.dma) + COS_COST_TILE_OVERHEAD) + first.dma;
+        if (tailDataNum != 0) {
+            cycles += std::max(tail.vec, tail.dma) + COS_COST_TILE_OVERHEAD;
+        }
+    } else {
+        cycles += fullTileNum * (full.vec + full.dma + COS_COST_TILE_OVERHEAD);
+        if (tailDataNum != 0) {
+            cycles += tail.vec + tail.dma + COS_COST_TILE_OVERHEAD;
+        }
+    }
+    return cycles;
+}
+
+/**
+ * Cuts inputNum elements into coreNum slices of whole alignDataNum units; big and small cores differ by
+ * exactly one unit and the last core is cut to the exact element count (tailCoreDataNum), so unaligned
+ * sizes are never read or written past the end of the tensor.
+ */
+inline CosSplitInfo CosSliceSplit(uint64_t inputNum, uint32_t alignDataNum, uint32_t coreNum, uint32_t tileDataNum)
+{
+    CosSplitInfo info;
+    uint64_t unitNum = (inputNum / alignDataNum) + (inputNum % alignDataNum != 0);
+    info.coreNum = coreNum;
+    info.alignDataNum = alignDataNum;
+    info.bigCoreNum = unitNum % coreNum;
+    info.smallCoreDataNum = unitNum / coreNum * alignDataNum;
+    info.bigCoreDataNum = info.smallCoreDataNum + alignDataNum;
+    info.tailCoreDataNum = info.smallCoreDataNum - (unitNum * alignDataNum - inputNum);
+    info.tileDataNum = tileDataNum;
+    return info;
+}
+
+/**
+ * Returns the modelled makespan of a split: launching its cores plus the busiest core, which starts
+ * on a burst boundary whenever the slice granularity is a whole number of bursts.
+ */
+inline uint64_t CosEstimateSplit(const CosSplitInfo& info, uint32_t xTypeLength, const CosCostInfo& cost)
+{
+    uint64_t sliceDataNum = (info.bigCoreNum != 0) ? info.bigCoreDataNum : info.smallCoreDataNum;
+    bool burstAligned = (static_cast<uint64_t>(info.alignDataNum) * xTypeLength % COS_GM_BURST_SIZE == 0);
+    return COS_COST_LAUNCH_PER_CORE * info.coreNum +
+           CosEstimateCore(sliceDataNum, xTypeLength, info.tileDataNum, burstAligned, info.coreNum, cost);
+}
+
+/**
+ * Sizes the UB tile in whole bursts so that ubTileNum tiles of the input type fit into ubSize, then splits inputNum
+ * elements over the core count and slice granularity (32-byte blocks or 512-byte GM bursts) with the
+ * smallest CosEstimateSplit makespan. Ties go to fewer cores, then to burst-aligned slices. Slices
+ * stay balanced to one unit for any 64-bit element count.
+ */
+inline CosSplitInfo CosCommonSplit(uint64_t inputNum, uint32_t xTypeLength, uint64_t ubSize,
+                                   uint32_t coreNum, uint32_t ubTileNum, const CosCostInfo& cost)
+{
+    uint32_t blockElemNum = BLOCK_SIZE / xTypeLength;
+    uint32_t burstElemNum = COS_GM_BURST_SIZE / xTypeLength;
+    // whole bursts per tile, so that tiles of a burst-aligned slice start on burst boundaries
+    uint64_t tileBlockNum = (ubSize / BLOCK_SIZE) / ubTileNum;
+    uint64_t burstBlockNum = COS_GM_BURST_SIZE / BLOCK_SIZE;
+    if (tileBlockNum >= burstBlockNum) {
+        tileBlockNum -= tileBlockNum % burstBlockNum;
+    }
+    uint32_t tileDataNum = static_cast<uint32_t>(tileBlockNum) * blockElemNum;
+
+    CosSplitInfo best = CosSliceSplit(inputNum, blockElemNum, 1, tileDataNum);
+    uint64_t bestCycles = CosEstimateSplit(best, xTypeLength, cost);
+    for (uint32_t splitCoreNum = 1; splitCoreNum <= coreNum; splitCoreNum++) {
+        for (uint32_t alignDataNum : {burstElemNum, blockElemNum}) {
+            if ((inputNum + alignDataNum - 1) / alignDataNum < splitCoreNum) {
+                continue;
+            }
+            CosSplitInfo info = CosSliceSplit(inputNum, alignDataNum, splitCoreNum, tileDataNum);
+            uint64_t cycles = CosEstimateSplit(info, xTypeLength, cost);
+            if (cycles < bestCycles) {
+                best = info;
+                bestCycles = cycles;
+            }
+        }
+    }
+    return best;
+}
+
+/**
+ * Returns the static shape bucket (1-based) whose per-core slice divides inputNum evenly onto no more
+ * than coreNum cores while keeping at least 3/4 of the cores the generic split would use, or 0 if
+ * the input has to take the generic path.
+ */
+inline uint32_t CosStaticBucket(uint64_t inputNum, uint32_t coreNum, const CosSplitInfo& info)
+{
+    if (inputNum == 0 || info.tileDataNum < COS_STATIC_TILE_DATA_NUM) {
+        return 0;
+    }
+    for (uint32_t bucket = 0; bucket < COS_STATIC_BUCKET_NUM; bucket++) {
+        uint32_t coreDataNum = COS_STATIC_CORE_DATA_NUM[bucket];
+        if (inputNum % coreDataNum != 0) {
+            continue;
+        }
+        uint64_t staticCoreNum = inputNum / coreDataNum;
+        if (staticCoreNum <= coreNum && staticCoreNum * 4 >= static_cast<uint64_t>(info.coreNum) * 3) {
+            return bucket + 1;
+        }
+    }
+    return 0;
+}
+
+// KernelCosLut keeps cos of every 16-bit pattern in UB, so the table needs no symmetry of the strategy
+// (HighPerfStrategy is not even on fp16). Every launch builds the table in the workspace, each core
+// computing its slice with the strategy of the replaced key, and loads all of it after a cross-core barrier
+constexpr uint32_t COS_LUT_TABLE_NUM = 65536;
+constexpr uint64_t COS_COST_SYNC_ALL = 2000;
+
+inline uint64_t CosLutTableBytes(uint32_t xTypeLength)
+{
+    return static_cast<uint64_t>(COS_LUT_TABLE_NUM) * xTypeLength;
+}
+
+// the table kernel replacing tableKey, one of keys 1 to 6
+inline uint64_t CosLutTilingKey(uint64_t tableKey)
+{
+    return COS_TILING_KEY_LUT + COS_TILING_KEY_STATIC_STEP * tableKey;
+}
+
+/**
+ * Splits inputNum 16-bit elements for the KernelCosLut of CosLutTilingKey(tableKey). Its tiles are laid out
+ * like those of the table strategy, which builds the table in them, in the UB left next to the table.
+ */
+inline CosSplitInfo CosLutSplit(uint64_t inputNum, uint32_t xTypeLength, uint64_t ubSize, uint32_t coreNum,
+                                uint64_t tableKey)
+{
+    uint32_t ubTileNum = CosUbTileNum(xTypeLength, 2, CosStrategyTmpBufNum(tableKey, false));
+    return CosCommonSplit(inputNum, xTypeLength, ubSize - CosLutTableBytes(xTypeLength), coreNum, ubTileNum,
+                          {COS_VEC_INSTR_NUM_LUT, 2, COS_BUFFER_NUM});
+}
+
+/**
+ * Returns the modelled makespan of KernelCosLut on a split from CosLutSplit: the gather pass plus building
+ * one core's slice of the table (CreateVecIndex and the table strategy, copied out), the barrier and
+ * loading the whole table.
+ */
+inline uint64_t CosEstimateLut(const CosSplitInfo& info, uint32_t xTypeLength, uint64_t tableKey)
+{
+    uint32_t blockElemNum = BLOCK_SIZE / xTypeLength;
+    uint64_t sliceNum = (COS_LUT_TABLE_NUM + info.coreNum - 1) / info.coreNum;
+    sliceNum = (sliceNum + blockElemNum - 1) / blockElemNum * blockElemNum;
+    uint64_t build = CosEstimateCore(sliceNum, xTypeLength, info.tileDataNum, true, info.coreNum,
+                                     {CosStrategyVecInstrNum(tableKey, false) + 1, 1, COS_BUFFER_NUM}) -
+                     COS_COST_CORE_SETUP;
+    CosTileCycles load = CosEstimateTile(COS_LUT_TABLE_NUM, xTypeLength, true, info.coreNum, {0, 1, 1});
+    return CosEstimateSplit(info, xTypeLength, {COS_VEC_INSTR_NUM_LUT, 2, COS_BUFFER_NUM}) + build +
+           COS_COST_SYNC_ALL + load.dma;
+}
+
+// dims of a collapsed view, VIEW_MAX_DIM in op_kernel/cos.cpp: aclnn tensors have at most 8
+constexpr uint32_t COS_VIEW_MAX_DIM = 8;
+
+/**
+ * A strided view of x as KernelCosView walks it: rows of rowLen elements that are contiguous in GM, laid
+ * out over dimNum outer dims of shape and stride (in elements, outermost first). dimNum == 0 means x
+ * is contiguous and takes the generic split.
+ */
+struct CosViewInfo {
+    uint32_t dimNum;
+    uint64_t rowLen;
+    uint64_t shape[COS_VIEW_MAX_DIM];
+    uint64_t stride[COS_VIEW_MAX_DIM];
+};
+
+/**
+ * Collapses the view of dimNum dims into a CosViewInfo: size-1 dims are dropped and neighbours that
+ * step through memory like one dim are merged. A stride-1 innermost dim becomes the row, otherwise
+ * rows are single elements. Returns false for negative strides and for more than COS_VIEW_MAX_DIM outer
+ * dims left after collapsing; dimNum itself is not bounded.
+ */
+inline bool CosCollapseView(const int64_t* shape, const int64_t* stride, uint32_t dimNum, CosViewInfo& view)
+{
+    view.dimNum = 0;
+    view.rowLen = 1;
+    // one more than the outer dims, for the row
+    uint64_t mergedShape[COS_VIEW_MAX_DIM + 1];
+    uint64_t mergedStride[COS_VIEW_MAX_DIM + 1];
+    uint32_t mergedNum = 0;
+    for (uint32_t i = 0; i < dimNum; i++) {
+        if (stride[i] < 0 || shape[i] < 0) {
+            return false;
+        }
+        if (shape[i] == 0) {
+            // empty, nothing to read
+            return true;
+        }
+        if (shape[i] == 1) {
+            continue;
+        }
+        uint64_t dim = static_cast<uint64_t>(shape[i]);
+        uint64_t step = static_cast<uint64_t>(stride[i]);
+        if (mergedNum != 0 && mergedStride[mergedNum - 1] == step * dim) {
+            mergedShape[mergedNum - 1] *= dim;
+            mergedStride[mergedNum - 1] = step;
+        } else {
+            if (mergedNum == COS_VIEW_MAX_DIM + 1) {
+                return false;
+            }
+            mergedShape[mergedNum] = dim;
+            mergedStride[mergedNum] = step;
+            mergedNum++;
+        }
+    }
+    if (mergedNum != 0 && mergedStride[mergedNum - 1] == 1) {
+        mergedNum--;
+        view.rowLen = mergedShape[mergedNum];
+    }
+    if (mergedNum > COS_VIEW_MAX_DIM) {
+        return false;
+    }
+    view.dimNum = mergedNum;
+    std::copy(mergedShape, mergedShape + mergedNum, view.shape);
+    std::copy(mergedStride, mergedStride + mergedNum, view.stride);
+    return true;
+}
+
+/**
+ * Returns the elements of one KernelCosView tile for a view of single-element rows. Each element is read
+ * into its own 32-byte block of the x queue, then gathered densely (a packed x copy and the Gather byte
+ * offsets) so the cast buffers, the strategy temporaries and y only hold the packed tile.
+ */
+inline uint32_t CosViewPackedTileDataNum(uint32_t xTypeLength, uint32_t yTypeLength, uint32_t tmpBufNum,
+                                         uint64_t ubSize)
+{
+    uint32_t castBufNum = (xTypeLength == sizeof(float) ? 0 : 1) + (yTypeLength == sizeof(float) ? 0 : 1);
+    uint64_t elemBytes = COS_BUFFER_NUM * (BLOCK_SIZE + yTypeLength) + xTypeLength + sizeof(uint32_t) +
+                         (castBufNum + tmpBufNum) * sizeof(float);
+    // whole blocks of the 16-bit side, so every buffer stays block aligned
+    uint32_t alignNum = BLOCK_SIZE / std::min(xTypeLength, yTypeLength);
+    return static_cast<uint32_t>(ubSize / elemBytes / alignNum * alignNum);
+}
+
+/**
+ * Splits a view for KernelCosView. Rows longer than a tile are cut into chunks of rowTileLen elements;
+ * shorter ones are padded to 32-byte blocks in UB and a tile holds as many as fit. Single-element rows
+ * are packed densely instead, tileDataNum from CosViewPackedTileDataNum. The core slices count row
+ * chunks, so bigCoreDataNum, smallCoreDataNum and tailCoreDataNum are chunk counts here, and tileDataNum
+ * is the UB elements of one tile. Nothing of x outside the view is read.
+ */
+inline CosSplitInfo CosViewSplit(const CosViewInfo& view, uint32_t xTypeLength, uint32_t yTypeLength,
+                                 uint32_t tmpBufNum, uint64_t ubSize, uint32_t coreNum, uint32_t& rowTileLen)
+{
+    uint32_t splitTypeLength = std::min(xTypeLength, yTypeLength);
+    uint32_t blockElemNum = BLOCK_SIZE / splitTypeLength;
+    uint32_t ubTileNum = CosUbTileNumCast(xTypeLength, yTypeLength, tmpBufNum);
+    uint32_t tileDataNum = static_cast<uint32_t>((ubSize / BLOCK_SIZE) / ubTileNum) * blockElemNum;
+    if (view.rowLen == 1) {
+        tileDataNum = CosViewPackedTileDataNum(xTypeLength, yTypeLength, tmpBufNum, ubSize);
+    }
+    rowTileLen = static_cast<uint32_t>(std::min<uint64_t>(view.rowLen, tileDataNum));
+    uint64_t chunkNum = (view.rowLen + rowTileLen - 1) / rowTileLen;
+    uint64_t rowNum = 1;
+    for (uint32_t i = 0; i < view.dimNum; i++) {
+        rowNum *= view.shape[i];
+    }
+    uint64_t unitNum = rowNum * chunkNum;
+    uint32_t splitCoreNum = static_cast<uint32_t>(std::min<uint64_t>(std::max<uint64_t>(unitNum, 1), coreNum));
+    return CosSliceSplit(unitNum, 1, splitCoreNum, tileDataNum);
+}
+
+// tiling keys of op_kernel/cos_grad.cpp: dx = -dy * sin(x) with sin(x) recomputed by HighPrecFusedStrategy,
+// or read from the sin_x saved by the forward pass
+constexpr uint64_t COS_GRAD_TILING_KEY_RECOMPUTE = 1;
+constexpr uint64_t COS_GRAD_TILING_KEY_SAVED_SIN = 2;
+// KernelCosGrad: Mul by dy and the Muls negating it, after ComputeSinImpl unless sin_x is given
+constexpr uint32_t COS_VEC_INSTR_NUM_GRAD = 2;
+
+// Cis writes every x as one complex64 (cos, sin) pair; KernelCis runs ComputeSinCosImpl into a planar
+// [cos | sin] float buffer and interleaves it with one Gather over twice the tile
+constexpr uint32_t COS_CIS_Y_TYPE_LENGTH = 8;
+constexpr uint32_t COS_VEC_INSTR_NUM_CIS = COS_VEC_INSTR_NUM_SIN_COS + 2;
+
+/**
+ * Splits inputNum elements of Cis. A tile holds the x and y queues, y being COS_CIS_Y_TYPE_LENGTH bytes per
+ * element, the float cast of 16-bit x, the planar cos/sin buffer and the Gather byte offsets (two 32-bit
+ * words per element each) and the HighPrecFusedStrategy temporaries. The cost model counts y as
+ * COS_CIS_Y_TYPE_LENGTH / xTypeLength queues of x, so it sees the real GM traffic.
+ */
+inline CosSplitInfo CosCisSplit(uint64_t inputNum, uint32_t xTypeLength, uint64_t ubSize, uint32_t coreNum)
+{
+    uint32_t castBufNum = (xTypeLength == sizeof(float)) ? 0 : 1;
+    uint32_t tileBytes = COS_BUFFER_NUM * (xTypeLength + COS_CIS_Y_TYPE_LENGTH) +
+                         (castBufNum + 2 + 2 + COS_TMP_BUF_NUM_HIGH_PREC) * sizeof(float);
+    uint32_t ubTileNum = (tileBytes + xTypeLength - 1) / xTypeLength;
+    uint32_t queueNum = 1 + COS_CIS_Y_TYPE_LENGTH / xTypeLength;
+    return CosCommonSplit(inputNum, xTypeLength, ubSize, coreNum, ubTileNum,
+                          {COS_VEC_INSTR_NUM_CIS, queueNum, COS_BUFFER_NUM});
+}
+
+// ForeachCos carries the length of every tensor of its list in the tiling data
+constexpr uint32_t COS_FOREACH_MAX_TENSOR_NUM = 64;
+
+/**
+ * Splits the tensorNum tensors of ForeachCos as one range of their summed length, so that a core slice may
+ * start in one tensor and end in another. Tiles are those of KernelCos with the strategy of tilingKey
+ * (COS_TILING_KEY_HIGH_PRECISION or COS_TILING_KEY_HIGH_PERFORMANCE).
+ */
+inline CosSplitInfo CosForeachSplit(const uint64_t* tensorDataNum, uint32_t tensorNum, uint32_t xTypeLength,
+                                    uint64_t ubSize, uint32_t coreNum, uint64_t tilingKey)
+{
+    uint64_t inputNum = 0;
+    for (uint32_t i = 0; i < tensorNum; i++) {
+        inputNum += tensorDataNum[i];
+    }
+    uint32_t ubTileNum = CosUbTileNum(xTypeLength, 2, CosStrategyTmpBufNum(tilingKey, false));
+    return CosCommonSplit(inputNum, xTypeLength, ubSize, coreNum, ubTileNum,
+                          {CosStrategyVecInstrNum(tilingKey, false), 2, COS_BUFFER_NUM});
+}
+
+// CosRope: headDim is a whole number of 16-bit blocks so that both halves of a row start on a 32-byte block, and
+// a float row spans at most 255 blocks, the largest repeat stride of a vector instruction
+constexpr uint32_t COS_ROPE_DIM_ALIGN = 16;
+constexpr uint32_t COS_ROPE_MAX_HEAD_DIM = 2032;
+
+/**
+ * Splits the rows of CosRope, one head of one token with headDim elements, over the cores and sizes a tile in
+ * whole rows. A tile keeps the angles, sin and cos of every token it touches, computed once for all of the
+ * token's heads, and tokenTileNum bounds how many tokens that is. Slices and tiles count rows; tileDataNum
+ * is 0 if not even one row fits into ubSize.
+ */
+inline CosSplitInfo CosRopeSplit(uint64_t tokenNum, uint32_t headNum, uint32_t headDim, uint32_t xTypeLength,
+                                 uint32_t posTypeLength, uint64_t ubSize, uint32_t coreNum, uint32_t& tokenTileNum)
+{
+    uint64_t halfDim = headDim / 2;
+    // x and y queues, plus one float buffer each on the 16-bit cast path
+    uint32_t castBufNum = (xTypeLength == sizeof(float)) ? 0 : 2;
+    uint64_t rowBytes = headDim * (2 * COS_BUFFER_NUM * xTypeLength + castBufNum * sizeof(float));
+    // angles (reused for -sin), sin, cos and the strategy temporaries, one position, its float copy and the
+    // block the kernel broadcasts it to
+    uint64_t tokenBytes = halfDim * (3 + COS_TMP_BUF_NUM_HIGH_PREC) * sizeof(float) +
+                          COS_BUFFER_NUM * posTypeLength + sizeof(float) + BLOCK_SIZE;
+    // inv_freq, the 32-byte round-up of each position buffer and that of the broadcast to 8 positions a repeat
+    uint64_t fixedBytes = halfDim * sizeof(float) + (COS_BUFFER_NUM + 1) * BLOCK_SIZE + 7 * BLOCK_SIZE;
+    uint64_t rowNum = tokenNum * headNum;
+
+    // rows [r, r + rowTileNum) touch at most rowTileNum / headNum + 2 tokens
+    uint64_t rowTileNum = 0;
+    if (ubSize >= fixedBytes + 2 * tokenBytes) {
+        rowTileNum = (ubSize - fixedBytes - 2 * tokenBytes) * headNum / (rowBytes * headNum + tokenBytes);
+    }
+    rowTileNum = std::min<uint64_t>({rowTileNum, std::max<uint64_t>(rowNum, 1), UINT32_MAX});
+    tokenTileNum = 0;
+    if (rowTileNum != 0) {
+        tokenTileNum = static_cast<uint32_t>(std::min<uint64_t>(rowTileNum, (rowTileNum + headNum - 2) / headNum + 1));
+    }
+    uint32_t splitCoreNum = static_cast<uint32_t>(std::min<uint64_t>(std::max<uint64_t>(rowNum, 1), coreNum));
+    return CosSliceSplit(rowNum, 1, splitCoreNum, static_cast<uint32_t>(rowTileNum));
+}
+
+// inputs of at most this many elements go to the AICPU kernel of opp_kernel_aicpu: below it the launch
+// and core setup of an AI core kernel outweigh the work. Re-measure with tests/benchmark/cos_aicpu_crossover
+constexpr int64_t COS_AICPU_MAX_DATA_NUM = 4096;
+
+/**
+ * Returns whether an input of inputNum elements runs on the AICPU kernel instead of AI core. Unknown
+ * (negative) sizes of dynamic shapes and empty tensors stay on AI core, whose tiling sees the real shape.
+ */
+inline bool CosPreferAicpu(int64_t inputNum)
+{
+    return inputNum > 0 && inputNum <= COS_AICPU_MAX_DATA_NUM;
+}
+
+// SoCs of the tuned tiling table written by tools/cos_autotune.py into op_host/cos_tuned_tiling.h
+constexpr uint32_t COS_TUNED_SOC_ASCEND910B = 1;
+constexpr uint32_t COS_TUNED_SOC_ASCEND310P = 2;
+
+/**
+ * One tuned configuration: on soc, inputs of xTypeLength bytes whose precision_mode key is modeKey and
+ * whose element count lies in [2^sizeLog2, 2^(sizeLog2 + 1)) run the generic split of tilingKey on
+ * coreNum cores in tiles of tileDataNum elements.
+ */
+struct CosTunedTiling {
+    uint32_t soc;
+    uint32_t xTypeLength;
+    uint64_t modeKey;
+    uint32_t sizeLog2;
+    uint64_t tilingKey;
+    uint32_t coreNum;
+    uint32_t tileDataNum;
+};
+
+inline uint32_t CosSizeLog2(uint64_t inputNum)
+{
+    uint32_t sizeLog2 = 0;
+    while (inputNum >>= 1) {
+        sizeLog2++;
+    }
+    return sizeLog2;
+}
+
+/**
+ * Returns the table entry for the given SoC, input type, precision_mode key and element count, or
+ * nullptr. Entries may only swap the mode key for its unfused strategy, so a tuned table never changes
+ * the accuracy the caller asked for.
+ */
+inline const CosTunedTiling* CosFindTunedTiling(const CosTunedTiling* table, size_t tableNum, uint32_t soc,
+                                                uint32_t xTypeLength, uint64_t modeKey, uint64_t inputNum)
+{
+    uint64_t unfusedKey = (modeKey == COS_TILING_KEY_HIGH_PRECISION) ? COS_TILING_KEY_HIGH_PRECISION_UNFUSED
+                                                                      : COS_TILING_KEY_HIGH_PERFORMANCE_UNFUSED;
+    uint32_t sizeLog2 = CosSizeLog2(inputNum);
+    for (size_t i = 0; i < tableNum; i++) {
+        const CosTunedTiling& tuned = table[i];
+        if (tuned.soc == soc && tuned.xTypeLength == xTypeLength && tuned.modeKey == modeKey &&
+            tuned.sizeLog2 == sizeLog2 && (tuned.tilingKey == modeKey || tuned.tilingKey == unfusedKey)) {
+            return &table[i];
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * Splits inputNum elements as the tuned entry says: its core count with burst-aligned slices where
+ * every core gets at least one burst, 32-byte blocks otherwise. Returns false, leaving info untouched,
+ * when the entry does not fit this launch: more cores than available or than blocks to hand out, or a
+ * tile that is not a whole number of blocks or overflows UB for the ubTileNum of its strategy.
+ */
+inline bool CosTunedSplit(const CosTunedTiling& tuned, uint64_t inputNum, uint64_t ubSize, uint32_t coreNum,
+                          uint32_t ubTileNum, CosSplitInfo& info)
+{
+    uint32_t blockElemNum = BLOCK_SIZE / tuned.xTypeLength;
+    uint32_t burstElemNum = COS_GM_BURST_SIZE / tuned.xTypeLength;
+    uint64_t blockNum = (inputNum + blockElemNum - 1) / blockElemNum;
+    if (tuned.coreNum == 0 || tuned.coreNum > coreNum || tuned.coreNum > blockNum) {
+        return false;
+    }
+    if (tuned.tileDataNum == 0 || tuned.tileDataNum % blockElemNum != 0 ||
+        static_cast<uint64_t>(tuned.tileDataNum) * tuned.xTypeLength * ubTileNum > ubSize) {
+        return false;
+    }
+    uint64_t burstNum = (inputNum + burstElemNum - 1) / burstElemNum;
+    uint32_t alignDataNum = (burstNum >= tuned.coreNum) ? burstElemNum : blockElemNum;
+    info = CosSliceSplit(inputNum, alignDataNum, tuned.coreNum, tuned.tileDataNum);
+    return true;
+}
+
+/**
+ * Picks the queue depth of the generic split. A single buffer is enough when every core processes one
+ * tile, which then grows by the UB the second copies would take. 16-bit inputs with at least
+ * COS_TRIPLE_BUFFER_MIN_TILE_NUM triple-buffered tiles per core spend most of a tile in MTE2/MTE3 (the
+ * vector pass runs in fp32 on half the bytes moved), so a third copy hides more of the copy latency.
+ * Everything else keeps COS_BUFFER_NUM. The caller sizes the tile with CosUbTileNum(..., bufferNum).
+ */
+inline uint32_t CosSelectBufferNum(uint64_t inputNum, uint32_t xTypeLength, uint64_t ubSize, uint32_t coreNum,
+                                   uint32_t queueNum, uint32_t tmpBufNum, uint32_t vecInstrNum)
+{
+    uint32_t singleTileNum = CosUbTileNum(xTypeLength, queueNum, tmpBufNum, COS_SINGLE_BUFFER_NUM);
+    CosSplitInfo single = CosCommonSplit(inputNum, xTypeLength, ubSize, coreNum, singleTileNum,
+                                         {vecInstrNum, queueNum, COS_SINGLE_BUFFER_NUM});
+    if (single.bigCoreDataNum <= single.tileDataNum) {
+        return COS_SINGLE_BUFFER_NUM;
+    }
+    if (xTypeLength != sizeof(float)) {
+        uint32_t tripleTileNum = CosUbTileNum(xTypeLength, queueNum, tmpBufNum, COS_TRIPLE_BUFFER_NUM);
+        CosSplitInfo triple = CosCommonSplit(inputNum, xTypeLength, ubSize, coreNum, tripleTileNum,
+                                             {vecInstrNum, queueNum, COS_TRIPLE_BUFFER_NUM});
+        if (triple.smallCoreDataNum >= COS_TRIPLE_BUFFER_MIN_TILE_NUM * triple.tileDataNum) {
+            return COS_TRIPLE_BUFFER_NUM;
+        }
+    }
+    return COS_BUFFER_NUM;
+}
+} // namespace optiling
+#endif // COS_TILING_COMMON_H
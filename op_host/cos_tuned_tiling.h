@@ -0,0 +1,25 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * @file cos_tuned_tiling.h
+ * Generated by tools/cos_autotune.py, do not edit. An empty table keeps the heuristic tiling everywhere.
+ */
+#ifndef COS_TUNED_TILING_H
+#define COS_TUNED_TILING_H
+#include <array>
+#include "cos_tiling_common.h"
+
+namespace optiling {
+// soc, xTypeLength, modeKey, sizeLog2, tilingKey, coreNum, tileDataNum
+constexpr std::array<CosTunedTiling, 0> COS_TUNED_TILING = {{
+}};
+} // namespace optiling
+#endif // COS_TUNED_TILING_H
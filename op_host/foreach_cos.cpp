@@ -0,0 +1,123 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * @file foreach_cos.cpp
+ */
+#include "foreach_cos_tiling.h"
+#include "cos_tiling_common.h"
+#include "register/op_def_registry.h"
+#include "graph/utils/type_utils.h"
+#include "tiling/platform/platform_ascendc.h"
+#include <cstring>
+
+namespace optiling {
+static ge::graphStatus TilingFunc(gert::TilingContext* context)
+{
+    ForeachCosTilingData tiling;
+    uint64_t ubSize;
+    auto ascendcPlatform = platform_ascendc::PlatformAscendC(context->GetPlatformInfo());
+    ascendcPlatform.GetCoreMemSize(platform_ascendc::CoreMemType::UB, ubSize);
+    auto coreNum = ascendcPlatform.GetCoreNum();
+    auto xType = context->GetInputDesc(0)->GetDataType();
+    uint32_t xTypeLength = (xType == ge::DT_FLOAT) ? 4 : 2;
+
+    uint32_t tensorNum = context->GetComputeNodeInfo()->GetInputInstanceInfo(0)->GetInstanceNum();
+    if (tensorNum == 0 || tensorNum > COS_FOREACH_MAX_TENSOR_NUM) {
+        return ge::GRAPH_FAILED;
+    }
+    uint64_t tensorDataNum[COS_FOREACH_MAX_TENSOR_NUM] = {};
+    for (uint32_t i = 0; i < tensorNum; i++) {
+        const gert::StorageShape* shape = context->GetDynamicInputShape(0, i);
+        if (shape == nullptr || context->GetDynamicInputDesc(0, i)->GetDataType() != xType) {
+            return ge::GRAPH_FAILED;
+        }
+        tensorDataNum[i] = shape->GetStorageShape().GetShapeSize();
+    }
+
+    uint64_t tilingKey;
+    const char* precisionMode = context->GetAttrs()->GetStr(0);
+    if (precisionMode == nullptr || strcmp(precisionMode, "high_precision") == 0) {
+        tilingKey = COS_TILING_KEY_HIGH_PRECISION;
+    } else if (strcmp(precisionMode, "high_performance") == 0) {
+        tilingKey = COS_TILING_KEY_HIGH_PERFORMANCE;
+    } else {
+        return ge::GRAPH_FAILED;
+    }
+    CosSplitInfo info = CosForeachSplit(tensorDataNum, tensorNum, xTypeLength, ubSize, coreNum, tilingKey);
+    context->SetTilingKey(tilingKey);
+
+    tiling.set_bigCoreDataNum(info.bigCoreDataNum);
+    tiling.set_smallCoreDataNum(info.smallCoreDataNum);
+    tiling.set_tailCoreDataNum(info.tailCoreDataNum);
+    tiling.set_tileDataNum(info.tileDataNum);
+    tiling.set_bigCoreNum(info.bigCoreNum);
+    tiling.set_tensorNum(tensorNum);
+    tiling.set_tensorDataNum(tensorDataNum);
+
+    context->SetBlockDim(info.coreNum);
+    tiling.SaveToBuffer(context->GetRawTilingData()->GetData(), context->GetRawTilingData()->GetCapacity());
+    context->GetRawTilingData()->SetDataSize(tiling.GetDataSize());
+    size_t *currentWorkspace = context->GetWorkspaceSizes(1);
+    currentWorkspace[0] = 0;
+    return ge::GRAPH_SUCCESS;
+}
+}
+
+
+namespace ge {
+static ge::graphStatus InferShape(gert::InferShapeContext* context)
+{
+    // y is as long a list as x, output i taking the shape of input i
+    for (size_t i = 0; i < context->GetComputeNodeInputNum(); i++) {
+        const gert::Shape* x_shape = context->GetDynamicInputShape(0, i);
+        gert::Shape* y_shape = context->GetOutputShape(i);
+        if (x_shape == nullptr || y_shape == nullptr) {
+            return GRAPH_FAILED;
+        }
+        *y_shape = *x_shape;
+    }
+    return GRAPH_SUCCESS;
+}
+static ge::graphStatus InferDataType(gert::InferDataTypeContext *context)
+{
+    for (size_t i = 0; i < context->GetComputeNodeInputNum(); i++) {
+        context->SetOutputDataType(i, context->GetInputDataType(i));
+    }
+    return ge::GRAPH_SUCCESS;
+}
+}
+
+
+namespace ops {
+class ForeachCos : public OpDef {
+public:
+    explicit ForeachCos(const char* name) : OpDef(name)
+    {
+        this->Input("x")
+            .ParamType(DYNAMIC)
+            .DataType({ge::DT_FLOAT16, ge::DT_FLOAT, ge::DT_BF16})
+            .Format({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND});
+        this->Output("y")
+            .ParamType(DYNAMIC)
+            .DataType({ge::DT_FLOAT16, ge::DT_FLOAT, ge::DT_BF16})
+            .Format({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND});
+        this->Attr("precision_mode").AttrType(OPTIONAL).String("high_precision");
+
+        this->SetInferShape(ge::InferShape).SetInferDataType(ge::InferDataType);
+
+        this->AICore()
+            .SetTiling(optiling::TilingFunc)
+            .AddConfig("ascend910b");
+    }
+};
+
+OP_ADD(ForeachCos);
+}
@@ -0,0 +1,33 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * @file foreach_cos_tiling.h
+ */
+#ifndef FOREACH_COS_TILING_H
+#define FOREACH_COS_TILING_H
+#include "register/tilingdata_base.h"
+
+namespace optiling {
+BEGIN_TILING_DATA_DEF(ForeachCosTilingData)
+  // core slices count elements of all tensors of the list laid end to end (CosForeachSplit)
+  TILING_DATA_FIELD_DEF(uint64_t, bigCoreDataNum);
+  TILING_DATA_FIELD_DEF(uint64_t, smallCoreDataNum);
+  TILING_DATA_FIELD_DEF(uint64_t, tailCoreDataNum);
+  TILING_DATA_FIELD_DEF(uint32_t, tileDataNum);
+  TILING_DATA_FIELD_DEF(uint32_t, bigCoreNum);
+  TILING_DATA_FIELD_DEF(uint32_t, tensorNum);
+  // COS_FOREACH_MAX_TENSOR_NUM
+  TILING_DATA_FIELD_DEF_ARR(uint64_t, 64, tensorDataNum);
+END_TILING_DATA_DEF;
+
+REGISTER_TILING_DATA_CLASS(ForeachCos, ForeachCosTilingData)
+} // namespace optiling
+#endif // FOREACH_COS_TILING_H
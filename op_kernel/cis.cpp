@@ -0,0 +1,212 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * @file cis.cpp
+ */
+#include "kernel_operator.h"
+#include "cos_strategy.h"
+
+constexpr int32_t BUFFER_NUM = 2;
+
+// y = cos(x) + i * sin(x) as complex64, written as interleaved (cos, sin) float pairs
+template <class T, class ComputeStrategy>
+class KernelCis
+{
+public:
+    __aicore__ inline KernelCis() {}
+    __aicore__ inline void Init(GM_ADDR x, GM_ADDR y,
+                                uint64_t bigCoreDataNum,
+                                uint64_t smallCoreDataNum,
+                                uint64_t tailCoreDataNum,
+                                uint32_t tileDataNum,
+                                uint32_t bigCoreNum,
+                                AscendC::TPipe* pipe);
+    __aicore__ inline void Process();
+
+private:
+    template <class U>
+    static __aicore__ inline const U& min(const U& a, const U& b) { return (b < a) ? b : a; }
+
+    __aicore__ inline void InitOffset();
+    __aicore__ inline void CopyIn(uint64_t offset, uint32_t processDataNum);
+    __aicore__ inline void Compute(uint32_t processDataNum);
+    __aicore__ inline void CopyOut(uint64_t offset, uint32_t processDataNum);
+
+    __aicore__ inline AscendC::LocalTensor<float> PreDeQueCastX(uint32_t processDataNum);
+
+private:
+    AscendC::TQue<AscendC::QuePosition::VECIN, 1> inQueueX;
+    AscendC::TQue<AscendC::QuePosition::VECOUT, 1> outQueueY;
+    AscendC::TBuf<AscendC::QuePosition::VECCALC> xBuf, planarBuf, offsetBuf;
+    AscendC::GlobalTensor<T> xGm;
+    // y viewed as 2 * coreDataNum floats
+    AscendC::GlobalTensor<float> yGm;
+
+    uint64_t coreDataNum;
+    uint32_t tileDataNum;
+
+    ComputeStrategy strategy;
+
+    static constexpr uint32_t BLOCK_ELEM_NUM = 32 / sizeof(T);
+    // complex64 elements per 32-byte block
+    static constexpr uint32_t Y_BLOCK_ELEM_NUM = 32 / (2 * sizeof(float));
+};
+
+template <class T, class ComputeStrategy>
+__aicore__ inline void KernelCis<T, ComputeStrategy>::Init(GM_ADDR x, GM_ADDR y,
+                                                           uint64_t bigCoreDataNum,
+                                                           uint64_t smallCoreDataNum,
+                                                           uint64_t tailCoreDataNum,
+                                                           uint32_t tileDataNum,
+                                                           uint32_t bigCoreNum,
+                                                           AscendC::TPipe* pipe)
+{
+    ASSERT(AscendC::GetBlockNum() != 0 && "block dim can not be zero!");
+    uint64_t globalBufferIndex = bigCoreDataNum * AscendC::GetBlockIdx();
+    if (AscendC::GetBlockIdx() < bigCoreNum) {
+        this->coreDataNum = bigCoreDataNum;
+    } else {
+        this->coreDataNum = smallCoreDataNum;
+        globalBufferIndex -= (bigCoreDataNum - smallCoreDataNum) * (AscendC::GetBlockIdx() - bigCoreNum);
+    }
+    // the last core ends exactly at the logical end of x
+    if (AscendC::GetBlockIdx() == AscendC::GetBlockNum() - 1) {
+        this->coreDataNum = tailCoreDataNum;
+    }
+    this->tileDataNum = tileDataNum;
+
+    xGm.SetGlobalBuffer((__gm__ T*)x + globalBufferIndex, this->coreDataNum);
+    yGm.SetGlobalBuffer((__gm__ float*)y + 2 * globalBufferIndex, 2 * this->coreDataNum);
+    pipe->InitBuffer(inQueueX, BUFFER_NUM, this->tileDataNum * sizeof(T));
+    pipe->InitBuffer(outQueueY, BUFFER_NUM, 2 * this->tileDataNum * sizeof(float));
+    if constexpr (!std::is_same_v<T, float>) {
+        pipe->InitBuffer(xBuf, this->tileDataNum * sizeof(float));
+    }
+    pipe->InitBuffer(planarBuf, 2 * this->tileDataNum * sizeof(float));
+    pipe->InitBuffer(offsetBuf, 2 * this->tileDataNum * sizeof(uint32_t));
+    strategy.InitBufImpl(pipe, this->tileDataNum);
+    InitOffset();
+}
+
+/**
+ * Builds the Gather byte offsets that interleave the planar buffer, cos at [0, tileDataNum) and sin at
+ * [tileDataNum, 2 * tileDataNum): float j of y reads element j / 2 of cos for even j and of sin for odd j.
+ * The offsets only depend on tileDataNum, so the tail tile reuses them with a shorter count.
+ */
+template <class T, class ComputeStrategy>
+__aicore__ inline void KernelCis<T, ComputeStrategy>::InitOffset()
+{
+    uint32_t offsetNum = 2 * this->tileDataNum;
+    AscendC::LocalTensor<int32_t> indexLocal = offsetBuf.Get<int32_t>();
+    AscendC::LocalTensor<float> halfFloat = planarBuf.Get<float>();
+    AscendC::LocalTensor<int32_t> halfLocal = planarBuf.Get<int32_t>();
+
+    AscendC::CreateVecIndex(indexLocal, 0, offsetNum);
+    // half = floor(j / 2), exact in float for any tile that fits in UB
+    AscendC::Cast(halfFloat, indexLocal, AscendC::RoundMode::CAST_NONE, offsetNum);
+    AscendC::Muls(halfFloat, halfFloat, 0.5f, offsetNum);
+    AscendC::Cast(halfLocal, halfFloat, AscendC::RoundMode::CAST_FLOOR, offsetNum);
+    // indexLocal = (j - 2 * half) * tileDataNum * 4 selects the sin half, halfLocal = half * 4
+    AscendC::Muls(halfLocal, halfLocal, 2, offsetNum);
+    AscendC::Sub(indexLocal, indexLocal, halfLocal, offsetNum);
+    AscendC::Muls(indexLocal, indexLocal, static_cast<int32_t>(this->tileDataNum * sizeof(float)), offsetNum);
+    AscendC::Muls(halfLocal, halfLocal, static_cast<int32_t>(sizeof(float) / 2), offsetNum);
+    AscendC::Add(indexLocal, indexLocal, halfLocal, offsetNum);
+}
+
+template <class T, class ComputeStrategy>
+__aicore__ inline void KernelCis<T, ComputeStrategy>::Process()
+{
+    uint64_t coreDataNum = this->coreDataNum;
+    uint64_t tileDataNum = this->tileDataNum;
+    for (uint64_t i = 0; i < coreDataNum; i += tileDataNum) {
+        uint32_t processDataNum = min(tileDataNum, coreDataNum - i);
+        CopyIn(i, processDataNum);
+        Compute(processDataNum);
+        CopyOut(i, processDataNum);
+    }
+}
+
+template <class T, class ComputeStrategy>
+__aicore__ inline void KernelCis<T, ComputeStrategy>::CopyIn(uint64_t offset, uint32_t processDataNum)
+{
+    AscendC::LocalTensor<T> xLocal = inQueueX.AllocTensor<T>();
+    if (processDataNum % BLOCK_ELEM_NUM == 0) {
+        AscendC::DataCopy(xLocal, xGm[offset], processDataNum);
+    } else {
+        AscendC::DataCopyExtParams copyParams{1, static_cast<uint32_t>(processDataNum * sizeof(T)), 0, 0, 0};
+        AscendC::DataCopyPadExtParams<T> padParams{false, 0, 0, 0};
+        AscendC::DataCopyPad(xLocal, xGm[offset], copyParams, padParams);
+    }
+    inQueueX.EnQue(xLocal);
+}
+
+template <class T, class ComputeStrategy>
+__aicore__ inline void KernelCis<T, ComputeStrategy>::Compute(uint32_t processDataNum)
+{
+    AscendC::LocalTensor<float> xLocal = PreDeQueCastX(processDataNum);
+    AscendC::LocalTensor<float> cosLocal = planarBuf.Get<float>();
+    AscendC::LocalTensor<float> sinLocal = cosLocal[this->tileDataNum];
+
+    strategy.ComputeSinCosImpl(xLocal, sinLocal, cosLocal, processDataNum);
+
+    if constexpr (std::is_same_v<T, float>) {
+        inQueueX.FreeTensor(xLocal);
+    }
+    AscendC::LocalTensor<float> yLocal = outQueueY.AllocTensor<float>();
+    AscendC::LocalTensor<uint32_t> offsetLocal = offsetBuf.Get<uint32_t>();
+    AscendC::Gather(yLocal, cosLocal, offsetLocal, 0, 2 * processDataNum);
+    outQueueY.EnQue(yLocal);
+}
+
+template <class T, class ComputeStrategy>
+__aicore__ inline void KernelCis<T, ComputeStrategy>::CopyOut(uint64_t offset, uint32_t processDataNum)
+{
+    AscendC::LocalTensor<float> yLocal = outQueueY.DeQue<float>();
+    if (processDataNum % Y_BLOCK_ELEM_NUM == 0) {
+        AscendC::DataCopy(yGm[2 * offset], yLocal, 2 * processDataNum);
+    } else {
+        AscendC::DataCopyExtParams copyParams{1, static_cast<uint32_t>(2 * processDataNum * sizeof(float)), 0, 0, 0};
+        AscendC::DataCopyPad(yGm[2 * offset], yLocal, copyParams);
+    }
+    outQueueY.FreeTensor(yLocal);
+}
+
+template <class T, class ComputeStrategy>
+__aicore__ inline AscendC::LocalTensor<float> KernelCis<T, ComputeStrategy>::PreDeQueCastX(uint32_t processDataNum)
+{
+    if constexpr (std::is_same_v<T, float>) {
+        AscendC::LocalTensor<float> xLocal = inQueueX.DeQue<float>();
+        return xLocal;
+    } else {
+        AscendC::LocalTensor<float> xLocal = xBuf.Get<float>();
+        AscendC::LocalTensor<T> xOrigin = inQueueX.DeQue<T>();
+        AscendC::Cast(xLocal, xOrigin, AscendC::RoundMode::CAST_NONE, processDataNum);
+        inQueueX.FreeTensor(xOrigin);
+        return xLocal;
+    }
+}
+
+extern "C" __global__ __aicore__ void cis(GM_ADDR x, GM_ADDR y, GM_ADDR workspace, GM_ADDR tiling)
+{
+    GET_TILING_DATA(tiling_data, tiling);
+
+    KernelCis<DTYPE_X, HighPrecFusedStrategy> op;
+    AscendC::TPipe pipe;
+    op.Init(x, y,
+            tiling_data.bigCoreDataNum,
+            tiling_data.smallCoreDataNum,
+            tiling_data.tailCoreDataNum,
+            tiling_data.tileDataNum,
+            tiling_data.bigCoreNum,
+            &pipe);
+    op.Process();
+}
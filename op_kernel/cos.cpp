@@ -12,19 +12,63 @@
  * @file cos.cpp
  */
 #include "kernel_operator.h"
+#include "cos_strategy.h"
 
-constexpr int32_t BUFFER_NUM = 2;
+constexpr int32_t DEFAULT_BUFFER_NUM = 2;
+constexpr uint32_t STATIC_TILE_DATA_NUM = 4096;
 
-template <class T, class ComputeStrategy>
+// y = alpha * cos(beta * x + gamma), the alpha, beta and gamma attributes of Cos. The range reduction
+// subtracts multiples of pi / 2 from beta * x + gamma itself, so beta cannot be folded into its
+// INV_HALF_PI multiply; each factor costs one Muls or Adds per tile and none at its identity value
+class CosAffine
+{
+public:
+    __aicore__ inline CosAffine() {}
+    __aicore__ inline void Init(float alpha, float beta, float gamma)
+    {
+        this->alpha = alpha;
+        this->beta = beta;
+        this->gamma = gamma;
+    }
+    __aicore__ inline void PreImpl(AscendC::LocalTensor<float>& xLocal, uint32_t processDataNum)
+    {
+        if (beta != 1.0f) {
+            AscendC::Muls(xLocal, xLocal, beta, processDataNum);
+        }
+        if (gamma != 0.0f) {
+            AscendC::Adds(xLocal, xLocal, gamma, processDataNum);
+        }
+    }
+    __aicore__ inline void PostImpl(AscendC::LocalTensor<float>& yLocal, uint32_t processDataNum)
+    {
+        if (alpha != 1.0f) {
+            AscendC::Muls(yLocal, yLocal, alpha, processDataNum);
+        }
+    }
+
+private:
+    float alpha = 1.0f;
+    float beta = 1.0f;
+    float gamma = 0.0f;
+};
+
+// STATIC_CORE_DATA_NUM != 0 selects the static shape variant: every core processes exactly
+// STATIC_CORE_DATA_NUM elements in STATIC_TILE_DATA_NUM tiles and the runtime tiling fields are ignored.
+// BUFFER_NUM is the queue depth picked by tiling together with tileDataNum (CosSelectBufferNum).
+// TOut is the type of y (dst_type), written straight from the float result
+template <class T, class ComputeStrategy, uint32_t STATIC_CORE_DATA_NUM = 0, int32_t BUFFER_NUM = DEFAULT_BUFFER_NUM,
+          class TOut = T>
 class KernelCos
 {
 public:
     __aicore__ inline KernelCos() {}
     __aicore__ inline void Init(GM_ADDR x, GM_ADDR y,
-                                uint32_t bigCoreDataNum,
-                                uint32_t smallCoreDataNum,
+                                uint64_t bigCoreDataNum,
+                                uint64_t smallCoreDataNum,
+                                uint64_t tailCoreDataNum,
                                 uint32_t tileDataNum,
                                 uint32_t bigCoreNum,
+                                const CosAffine& affine,
                                 AscendC::TPipe* pipe);
     __aicore__ inline void Process();
 
@@ -47,85 +91,135 @@ private:
     AscendC::TQue<AscendC::QuePosition::VECOUT, 1> outQueueY;
     AscendC::TBuf<AscendC::QuePosition::VECCALC> xBuf, yBuf;
     AscendC::GlobalTensor<T> xGm;
-    AscendC::GlobalTensor<T> yGm;
+    AscendC::GlobalTensor<TOut> yGm;
 
-    uint32_t coreDataNum;
+    uint64_t coreDataNum;
     uint32_t tileDataNum;
 
     ComputeStrategy strategy;
+    CosAffine affine;
+
+    static constexpr uint32_t BLOCK_ELEM_NUM = 32 / sizeof(T);
+    static constexpr uint32_t OUT_BLOCK_ELEM_NUM = 32 / sizeof(TOut);
 };
 
-template <class T, class ComputeStrategy>
-__aicore__ inline void KernelCos<T, ComputeStrategy>::Init(GM_ADDR x, GM_ADDR y,
-                                                           uint32_t bigCoreDataNum,
-                                                           uint32_t smallCoreDataNum,
-                                                           uint32_t tileDataNum,
-                                                           uint32_t bigCoreNum,
-                                                           AscendC::TPipe* pipe)
+template <class T, class ComputeStrategy, uint32_t STATIC_CORE_DATA_NUM, int32_t BUFFER_NUM, class TOut>
+__aicore__ inline void KernelCos<T, ComputeStrategy, STATIC_CORE_DATA_NUM, BUFFER_NUM, TOut>::Init(
+    GM_ADDR x, GM_ADDR y, uint64_t bigCoreDataNum, uint64_t smallCoreDataNum, uint64_t tailCoreDataNum,
+    uint32_t tileDataNum, uint32_t bigCoreNum, const CosAffine& affine, AscendC::TPipe* pipe)
 {
     ASSERT(AscendC::GetBlockNum() != 0 && "block dim can not be zero!");
-    uint32_t globalBufferIndex = bigCoreDataNum * AscendC::GetBlockIdx();
-    if (AscendC::GetBlockIdx() <= bigCoreNum) {
-        this->coreDataNum = bigCoreDataNum;
+    uint64_t globalBufferIndex;
+    if constexpr (STATIC_CORE_DATA_NUM != 0) {
+        globalBufferIndex = STATIC_CORE_DATA_NUM * AscendC::GetBlockIdx();
+        this->coreDataNum = STATIC_CORE_DATA_NUM;
+        this->tileDataNum = STATIC_CORE_DATA_NUM < STATIC_TILE_DATA_NUM ? STATIC_CORE_DATA_NUM : STATIC_TILE_DATA_NUM;
     } else {
-        this->coreDataNum = smallCoreDataNum;
-        globalBufferIndex -= (bigCoreDataNum - smallCoreDataNum) * (AscendC::GetBlockIdx() - bigCoreNum);
+        globalBufferIndex = bigCoreDataNum * AscendC::GetBlockIdx();
+        if (AscendC::GetBlockIdx() < bigCoreNum) {
+            this->coreDataNum = bigCoreDataNum;
+        } else {
+            this->coreDataNum = smallCoreDataNum;
+            globalBufferIndex -= (bigCoreDataNum - smallCoreDataNum) * (AscendC::GetBlockIdx() - bigCoreNum);
+        }
+        // the last core ends exactly at the logical end of x
+        if (AscendC::GetBlockIdx() == AscendC::GetBlockNum() - 1) {
+            this->coreDataNum = tailCoreDataNum;
+        }
+        this->tileDataNum = tileDataNum;
     }
-    this->tileDataNum = tileDataNum;
 
     xGm.SetGlobalBuffer((__gm__ T*)x + globalBufferIndex, this->coreDataNum);
-    yGm.SetGlobalBuffer((__gm__ T*)y + globalBufferIndex, this->coreDataNum);
+    yGm.SetGlobalBuffer((__gm__ TOut*)y + globalBufferIndex, this->coreDataNum);
     pipe->InitBuffer(inQueueX, BUFFER_NUM, this->tileDataNum * sizeof(T));
-    pipe->InitBuffer(outQueueY, BUFFER_NUM, this->tileDataNum * sizeof(T));
+    pipe->InitBuffer(outQueueY, BUFFER_NUM, this->tileDataNum * sizeof(TOut));
     if constexpr (!std::is_same_v<T, float>) {
         pipe->InitBuffer(xBuf, this->tileDataNum * sizeof(float));
+    }
+    if constexpr (!std::is_same_v<TOut, float>) {
         pipe->InitBuffer(yBuf, this->tileDataNum * sizeof(float));
     }
     strategy.InitBufImpl(pipe, this->tileDataNum);
+    this->affine = affine;
 }
 
-template <class T, class ComputeStrategy>
-__aicore__ inline void KernelCos<T, ComputeStrategy>::Process()
+template <class T, class ComputeStrategy, uint32_t STATIC_CORE_DATA_NUM, int32_t BUFFER_NUM, class TOut>
+__aicore__ inline void KernelCos<T, ComputeStrategy, STATIC_CORE_DATA_NUM, BUFFER_NUM, TOut>::Process()
 {
-    uint64_t coreDataNum = this->coreDataNum;
-    uint64_t tileDataNum = this->tileDataNum;
-    for (uint64_t i = 0; i < coreDataNum; i += tileDataNum) {
-        uint32_t processDataNum = min(tileDataNum, coreDataNum - i);
-        CopyIn(i, processDataNum);
-        Compute(processDataNum);
-        CopyOut(i, processDataNum);
+    if constexpr (STATIC_CORE_DATA_NUM != 0) {
+        constexpr uint32_t tileDataNum =
+            STATIC_CORE_DATA_NUM < STATIC_TILE_DATA_NUM ? STATIC_CORE_DATA_NUM : STATIC_TILE_DATA_NUM;
+        constexpr uint32_t tileNum = STATIC_CORE_DATA_NUM / tileDataNum;
+        constexpr uint32_t tailDataNum = STATIC_CORE_DATA_NUM % tileDataNum;
+        for (uint32_t i = 0; i < tileNum; i++) {
+            CopyIn(i * tileDataNum, tileDataNum);
+            Compute(tileDataNum);
+            CopyOut(i * tileDataNum, tileDataNum);
+        }
+        if constexpr (tailDataNum != 0) {
+            CopyIn(tileNum * tileDataNum, tailDataNum);
+            Compute(tailDataNum);
+            CopyOut(tileNum * tileDataNum, tailDataNum);
+        }
+    } else {
+        uint64_t coreDataNum = this->coreDataNum;
+        uint64_t tileDataNum = this->tileDataNum;
+        for (uint64_t i = 0; i < coreDataNum; i += tileDataNum) {
+            uint32_t processDataNum = min(tileDataNum, coreDataNum - i);
+            CopyIn(i, processDataNum);
+            Compute(processDataNum);
+            CopyOut(i, processDataNum);
+        }
     }
 }
 
-template <class T, class ComputeStrategy>
-__aicore__ inline void KernelCos<T, ComputeStrategy>::CopyIn(uint64_t offset, uint32_t processDataNum)
+template <class T, class ComputeStrategy, uint32_t STATIC_CORE_DATA_NUM, int32_t BUFFER_NUM, class TOut>
+__aicore__ inline void
+KernelCos<T, ComputeStrategy, STATIC_CORE_DATA_NUM, BUFFER_NUM, TOut>::CopyIn(uint64_t offset, uint32_t processDataNum)
 {
     AscendC::LocalTensor<T> xLocal = inQueueX.AllocTensor<T>();
-    AscendC::DataCopy(xLocal, xGm[offset], processDataNum);
+    if (processDataNum % BLOCK_ELEM_NUM == 0) {
+        AscendC::DataCopy(xLocal, xGm[offset], processDataNum);
+    } else {
+        AscendC::DataCopyExtParams copyParams{1, static_cast<uint32_t>(processDataNum * sizeof(T)), 0, 0, 0};
+        AscendC::DataCopyPadExtParams<T> padParams{false, 0, 0, 0};
+        AscendC::DataCopyPad(xLocal, xGm[offset], copyParams, padParams);
+    }
     inQueueX.EnQue(xLocal);
 }
 
-template <class T, class ComputeStrategy>
-__aicore__ inline void KernelCos<T, ComputeStrategy>::Compute(uint32_t processDataNum)
+template <class T, class ComputeStrategy, uint32_t STATIC_CORE_DATA_NUM, int32_t BUFFER_NUM, class TOut>
+__aicore__ inline void
+KernelCos<T, ComputeStrategy, STATIC_CORE_DATA_NUM, BUFFER_NUM, TOut>::Compute(uint32_t processDataNum)
 {
     AscendC::LocalTensor<float> xLocal = PreDeQueCastX(processDataNum);
     AscendC::LocalTensor<float> yLocal = PreAllocateY();
 
+    affine.PreImpl(xLocal, processDataNum);
     strategy.ComputeImpl(xLocal, yLocal, processDataNum);
+    affine.PostImpl(yLocal, processDataNum);
 
     PostReleaseCastEnQue(xLocal, yLocal, processDataNum);
 }
 
-template <class T, class ComputeStrategy>
-__aicore__ inline void KernelCos<T, ComputeStrategy>::CopyOut(uint64_t offset, uint32_t processDataNum)
+template <class T, class ComputeStrategy, uint32_t STATIC_CORE_DATA_NUM, int32_t BUFFER_NUM, class TOut>
+__aicore__ inline void
+KernelCos<T, ComputeStrategy, STATIC_CORE_DATA_NUM, BUFFER_NUM, TOut>::CopyOut(uint64_t offset, uint32_t processDataNum)
 {
-    AscendC::LocalTensor<T> yLocal = outQueueY.DeQue<T>();
-    AscendC::DataCopy(yGm[offset], yLocal, processDataNum);
+    AscendC::LocalTensor<TOut> yLocal = outQueueY.DeQue<TOut>();
+    if (processDataNum % OUT_BLOCK_ELEM_NUM == 0) {
+        AscendC::DataCopy(yGm[offset], yLocal, processDataNum);
+    } else {
+        AscendC::DataCopyExtParams copyParams{1, static_cast<uint32_t>(processDataNum * sizeof(TOut)), 0, 0, 0};
+        AscendC::DataCopyPad(yGm[offset], yLocal, copyParams);
+    }
     outQueueY.FreeTensor(yLocal);
 }
 
-template <class T, class ComputeStrategy>
-__aicore__ inline AscendC::LocalTensor<float> KernelCos<T, ComputeStrategy>::PreDeQueCastX(uint32_t processDataNum)
+template <class T, class ComputeStrategy, uint32_t STATIC_CORE_DATA_NUM, int32_t BUFFER_NUM, class TOut>
+__aicore__ inline AscendC::LocalTensor<float>
+KernelCos<T, ComputeStrategy, STATIC_CORE_DATA_NUM, BUFFER_NUM, TOut>::PreDeQueCastX(
+    uint32_t processDataNum)
 {
     if constexpr (std::is_same_v<T, float>) {
         AscendC::LocalTensor<float> xLocal = inQueueX.DeQue<float>();
@@ -139,10 +233,11 @@ __aicore__ inline AscendC::LocalTensor<float> KernelCos<T, ComputeStrategy>::Pre
     }
 }
 
-template <class T, class ComputeStrategy>
-__aicore__ inline AscendC::LocalTensor<float> KernelCos<T, ComputeStrategy>::PreAllocateY()
+template <class T, class ComputeStrategy, uint32_t STATIC_CORE_DATA_NUM, int32_t BUFFER_NUM, class TOut>
+__aicore__ inline AscendC::LocalTensor<float>
+KernelCos<T, ComputeStrategy, STATIC_CORE_DATA_NUM, BUFFER_NUM, TOut>::PreAllocateY()
 {
-    if constexpr (std::is_same_v<T, float>) {
+    if constexpr (std::is_same_v<TOut, float>) {
         AscendC::LocalTensor<float> yLocal = outQueueY.AllocTensor<float>();
         return yLocal;
     } else {
@@ -151,16 +246,18 @@ __aicore__ inline AscendC::LocalTensor<float> KernelCos<T, ComputeStrategy>::Pre
     }
 }
 
-template <class T, class ComputeStrategy>
-__aicore__ inline void KernelCos<T, ComputeStrategy>::PostReleaseCastEnQue(AscendC::LocalTensor<float>& xLocal,
-                                                                           AscendC::LocalTensor<float>& yLocal,
-                                                                           uint32_t processDataNum)
+template <class T, class ComputeStrategy, uint32_t STATIC_CORE_DATA_NUM, int32_t BUFFER_NUM, class TOut>
+__aicore__ inline void KernelCos<T, ComputeStrategy, STATIC_CORE_DATA_NUM, BUFFER_NUM, TOut>::PostReleaseCastEnQue(
+    AscendC::LocalTensor<float>& xLocal, AscendC::LocalTensor<float>& yLocal, uint32_t processDataNum)
 {
+    // 16-bit inputs were released by PreDeQueCastX after widening
     if constexpr (std::is_same_v<T, float>) {
-        outQueueY.EnQue(yLocal);
         inQueueX.FreeTensor(xLocal);
+    }
+    if constexpr (std::is_same_v<TOut, float>) {
+        outQueueY.EnQue(yLocal);
     } else {
-        AscendC::LocalTensor<T> yTarget = outQueueY.AllocTensor<T>();
+        AscendC::LocalTensor<TOut> yTarget = outQueueY.AllocTensor<TOut>();
     #if __CCE_AICORE__ == 200
         AscendC::Cast(yTarget, yLocal, AscendC::RoundMode::CAST_NONE, processDataNum);
     #else
@@ -170,698 +267,769 @@ __aicore__ inline void KernelCos<T, ComputeStrategy>::PostReleaseCastEnQue(Ascen
     }
 }
 
-class RefStrategy
+template <class ComputeStrategy, uint32_t STATIC_CORE_DATA_NUM = 0, int32_t BUFFER_NUM = DEFAULT_BUFFER_NUM>
+__aicore__ inline void RunKernelCos(GM_ADDR x, GM_ADDR y, const CosTilingData& tiling_data)
+{
+    KernelCos<DTYPE_X, ComputeStrategy, STATIC_CORE_DATA_NUM, BUFFER_NUM, DTYPE_Y> op;
+    AscendC::TPipe pipe;
+    CosAffine affine;
+    affine.Init(tiling_data.alpha, tiling_data.beta, tiling_data.gamma);
+    op.Init(x, y,
+            tiling_data.bigCoreDataNum,
+            tiling_data.smallCoreDataNum,
+            tiling_data.tailCoreDataNum,
+            tiling_data.tileDataNum,
+            tiling_data.bigCoreNum,
+            affine,
+            &pipe);
+    op.Process();
+}
+
+// dims of a collapsed view, COS_VIEW_MAX_DIM in op_host/cos_tiling_common.h
+constexpr uint32_t VIEW_MAX_DIM = 8;
+// blockCount of DataCopyExtParams is 12 bits
+constexpr uint32_t VIEW_MAX_BLOCK_COUNT = 4095;
+
+// strided views of x (CosViewInfo in op_host/cos_tiling_common.h): rows of rowLen contiguous elements over
+// viewDimNum outer dims of any stride are read in place and y is written contiguous. Each row, or each
+// rowTileLen chunk of a long one, starts on a 32-byte block in UB, so short rows leave padding the
+// strategy computes on and CopyOut skips. Single-element rows (no stride-1 dim, e.g. a transpose) are
+// gathered out of their blocks into a dense tile first. The core slices count row chunks instead of
+// elements. TOut is the type of y as in KernelCos
+template <class T, class ComputeStrategy, int32_t BUFFER_NUM = DEFAULT_BUFFER_NUM, class TOut = T>
+class KernelCosView
 {
 public:
-    __aicore__ inline RefStrategy() {}
-    __aicore__ inline void InitBufImpl(AscendC::TPipe* pipe, uint32_t tileDataNum);
-    __aicore__ inline void ComputeImpl(AscendC::LocalTensor<float>& xLocal,
-                                       AscendC::LocalTensor<float>& yLocal,
-                                       uint32_t processDataNum);
+    __aicore__ inline KernelCosView() {}
+    __aicore__ inline void Init(GM_ADDR x, GM_ADDR y, const CosTilingData& tiling_data, AscendC::TPipe* pipe);
+    __aicore__ inline void Process();
+
+private:
+    template <class U>
+    static __aicore__ inline const U& min(const U& a, const U& b) { return (b < a) ? b : a; }
+
+    __aicore__ inline uint64_t RowOffset(uint64_t row);
+    __aicore__ inline uint32_t CopyIn(uint64_t unit, uint32_t unitNum);
+    __aicore__ inline void Compute(uint32_t processDataNum);
+    __aicore__ inline void CopyOut(uint64_t unit, uint32_t unitNum);
+
+    __aicore__ inline AscendC::LocalTensor<float> PreDeQueCastX(uint32_t processDataNum);
+    __aicore__ inline AscendC::LocalTensor<T> GatherPackedX(uint32_t processDataNum);
 
 private:
-    AscendC::TBuf<AscendC::QuePosition::VECCALC> tmpBuf1, tmpBuf2;
+    AscendC::TQue<AscendC::QuePosition::VECIN, 1> inQueueX;
+    AscendC::TQue<AscendC::QuePosition::VECOUT, 1> outQueueY;
+    AscendC::TBuf<AscendC::QuePosition::VECCALC> xBuf, yBuf, xPackBuf, offsetBuf;
+    AscendC::GlobalTensor<T> xGm;
+    AscendC::GlobalTensor<TOut> yGm;
+
+    uint64_t coreUnitBegin;
+    uint64_t coreUnitNum;
+    uint64_t rowLen;
+    uint32_t rowTileLen;
+    uint32_t rowTileAlignNum;
+    uint64_t chunkNum;
+    uint32_t tileUnitNum;
+    // 32-byte blocks between two rows in UB beyond the padding DataCopyPad adds for x and y
+    uint32_t xRowGap;
+    uint32_t yRowGap;
+    // rowLen == 1: every element sits in its own 32-byte block of the x queue and is gathered densely
+    bool packed;
+    uint32_t dimNum;
+    uint64_t shape[VIEW_MAX_DIM];
+    uint64_t stride[VIEW_MAX_DIM];
+
+    ComputeStrategy strategy;
+    CosAffine affine;
+
+    // UB rows start on a 32-byte block of both x and y
+    static constexpr uint32_t BLOCK_ELEM_NUM = 32 / (sizeof(T) < sizeof(TOut) ? sizeof(T) : sizeof(TOut));
+    static constexpr uint32_t X_BLOCK_ELEM_NUM = 32 / sizeof(T);
+    // Gather moves raw 16 or 32-bit words, whatever T is
+    using GatherT = std::conditional_t<sizeof(T) == sizeof(uint16_t), uint16_t, uint32_t>;
 };
 
-__aicore__ inline void RefStrategy::InitBufImpl(AscendC::TPipe* pipe, uint32_t tileDataNum)
+template <class T, class ComputeStrategy, int32_t BUFFER_NUM, class TOut>
+__aicore__ inline void KernelCosView<T, ComputeStrategy, BUFFER_NUM, TOut>::Init(
+    GM_ADDR x, GM_ADDR y, const CosTilingData& tiling_data, AscendC::TPipe* pipe)
+{
+    ASSERT(AscendC::GetBlockNum() != 0 && "block dim can not be zero!");
+    this->coreUnitBegin = tiling_data.bigCoreDataNum * AscendC::GetBlockIdx();
+    if (AscendC::GetBlockIdx() < tiling_data.bigCoreNum) {
+        this->coreUnitNum = tiling_data.bigCoreDataNum;
+    } else {
+        this->coreUnitNum = tiling_data.smallCoreDataNum;
+        this->coreUnitBegin -= (tiling_data.bigCoreDataNum - tiling_data.smallCoreDataNum) *
+                               (AscendC::GetBlockIdx() - tiling_data.bigCoreNum);
+    }
+    this->rowLen = tiling_data.rowLen;
+    this->rowTileLen = tiling_data.rowTileLen;
+    this->rowTileAlignNum = (this->rowTileLen + BLOCK_ELEM_NUM - 1) / BLOCK_ELEM_NUM * BLOCK_ELEM_NUM;
+    this->chunkNum = (this->rowLen + this->rowTileLen - 1) / this->rowTileLen;
+    this->packed = (this->rowLen == 1);
+    this->tileUnitNum = this->packed ? tiling_data.tileDataNum : tiling_data.tileDataNum / this->rowTileAlignNum;
+    this->xRowGap = 0;
+    this->yRowGap = 0;
+    if (this->chunkNum == 1 && !this->packed) {
+        constexpr uint32_t xBlockElemNum = 32 / sizeof(T);
+        constexpr uint32_t yBlockElemNum = 32 / sizeof(TOut);
+        this->xRowGap = (this->rowTileAlignNum - (this->rowLen + xBlockElemNum - 1) / xBlockElemNum * xBlockElemNum) /
+                        xBlockElemNum;
+        this->yRowGap = (this->rowTileAlignNum - (this->rowLen + yBlockElemNum - 1) / yBlockElemNum * yBlockElemNum) /
+                        yBlockElemNum;
+    }
+    this->dimNum = tiling_data.viewDimNum;
+    for (uint32_t i = 0; i < this->dimNum; i++) {
+        this->shape[i] = tiling_data.viewShape[i];
+        this->stride[i] = tiling_data.viewStride[i];
+    }
+
+    // the view may reach anywhere in the storage of x, y is the dense output
+    xGm.SetGlobalBuffer((__gm__ T*)x);
+    yGm.SetGlobalBuffer((__gm__ TOut*)y);
+    pipe->InitBuffer(inQueueX, BUFFER_NUM, tiling_data.tileDataNum * (this->packed ? 32 : sizeof(T)));
+    pipe->InitBuffer(outQueueY, BUFFER_NUM, tiling_data.tileDataNum * sizeof(TOut));
+    if (this->packed) {
+        pipe->InitBuffer(xPackBuf, tiling_data.tileDataNum * sizeof(T));
+        pipe->InitBuffer(offsetBuf, tiling_data.tileDataNum * sizeof(uint32_t));
+        // element i of the x queue is at byte 32 * i
+        AscendC::LocalTensor<int32_t> offsetLocal = offsetBuf.Get<int32_t>();
+        AscendC::CreateVecIndex(offsetLocal, 0, tiling_data.tileDataNum);
+        AscendC::Muls(offsetLocal, offsetLocal, 32, tiling_data.tileDataNum);
+    }
+    if constexpr (!std::is_same_v<T, float>) {
+        pipe->InitBuffer(xBuf, tiling_data.tileDataNum * sizeof(float));
+    }
+    if constexpr (!std::is_same_v<TOut, float>) {
+        pipe->InitBuffer(yBuf, tiling_data.tileDataNum * sizeof(float));
+    }
+    strategy.InitBufImpl(pipe, tiling_data.tileDataNum);
+    affine.Init(tiling_data.alpha, tiling_data.beta, tiling_data.gamma);
+}
+
+template <class T, class ComputeStrategy, int32_t BUFFER_NUM, class TOut>
+__aicore__ inline void KernelCosView<T, ComputeStrategy, BUFFER_NUM, TOut>::Process()
 {
-    pipe->InitBuffer(tmpBuf1, tileDataNum * sizeof(float));
-    pipe->InitBuffer(tmpBuf2, tileDataNum * sizeof(float));
+    // long rows are cut into chunks, one per tile; short ones are packed tileUnitNum to a tile
+    uint32_t tileUnitNum = (this->chunkNum == 1) ? this->tileUnitNum : 1;
+    for (uint64_t i = 0; i < this->coreUnitNum; i += tileUnitNum) {
+        uint32_t unitNum = min<uint64_t>(tileUnitNum, this->coreUnitNum - i);
+        uint32_t processDataNum = CopyIn(this->coreUnitBegin + i, unitNum);
+        Compute(processDataNum);
+        CopyOut(this->coreUnitBegin + i, unitNum);
+    }
 }
 
-constexpr float TWO_PI = 2 * 3.14159265358979;
-constexpr float REF_COEF_2 = -1.0 / (2 * 1);
-constexpr float REF_COEF_4 = -1.0 / (4 * 3);
-constexpr float REF_COEF_6 = -1.0 / (6 * 5);
-constexpr float REF_COEF_8 = -1.0 / (8 * 7);
-constexpr float REF_COEF_10 = -1.0 / (10 * 9);
-constexpr float REF_COEF_12 = -1.0 / (12 * 11);
-constexpr float REF_COEF_14 = -1.0 / (14 * 13);
+template <class T, class ComputeStrategy, int32_t BUFFER_NUM, class TOut>
+__aicore__ inline uint64_t KernelCosView<T, ComputeStrategy, BUFFER_NUM, TOut>::RowOffset(uint64_t row)
+{
+    uint64_t offset = 0;
+    for (int32_t i = static_cast<int32_t>(this->dimNum) - 1; i >= 0; i--) {
+        offset += (row % this->shape[i]) * this->stride[i];
+        row /= this->shape[i];
+    }
+    return offset;
+}
 
-__aicore__ inline void RefStrategy::ComputeImpl(AscendC::LocalTensor<float>& xLocal,
-                                                AscendC::LocalTensor<float>& yLocal,
-                                                uint32_t processDataNum)
-{
-    AscendC::LocalTensor<float> tmpTensor1 = tmpBuf1.Get<float>();
-    AscendC::LocalTensor<float> tmpTensor2 = tmpBuf2.Get<float>();
-
-    const AscendC::LocalTensor<float>& input_x = xLocal;
-    const AscendC::LocalTensor<float>& vmu_ = tmpTensor1;
-    const AscendC::LocalTensor<int32_t>& round_fp = yLocal.ReinterpretCast<int32_t>();
-    const AscendC::LocalTensor<float>& round_fp32 = tmpTensor1;
-    const AscendC::LocalTensor<float>& t = tmpTensor2;
-    const AscendC::LocalTensor<float>& input_x_round = yLocal;
-    const AscendC::LocalTensor<float>& res = tmpTensor1;
-    const AscendC::LocalTensor<float>& input_x_power = xLocal;
-    const AscendC::LocalTensor<float>& iter_value = tmpTensor2;
-    const AscendC::LocalTensor<float>& res_1 = yLocal;
-    const AscendC::LocalTensor<float>& t_1 = tmpTensor1;
-    const AscendC::LocalTensor<float>& iter_value_1 = tmpTensor2;
-    const AscendC::LocalTensor<float>& res_2 = tmpTensor1;
-    const AscendC::LocalTensor<float>& t_2 = yLocal;
-    const AscendC::LocalTensor<float>& iter_value_2 = tmpTensor2;
-    const AscendC::LocalTensor<float>& res_3 = yLocal;
-    const AscendC::LocalTensor<float>& t_3 = tmpTensor1;
-    const AscendC::LocalTensor<float>& iter_value_3 = tmpTensor2;
-    const AscendC::LocalTensor<float>& res_4 = tmpTensor1;
-    const AscendC::LocalTensor<float>& t_4 = yLocal;
-    const AscendC::LocalTensor<float>& iter_value_4 = tmpTensor2;
-    const AscendC::LocalTensor<float>& res_5 = yLocal;
-    const AscendC::LocalTensor<float>& t_5 = tmpTensor1;
-    const AscendC::LocalTensor<float>& iter_value_5 = tmpTensor2;
-    const AscendC::LocalTensor<float>& res_6 = tmpTensor1;
-    const AscendC::LocalTensor<float>& t_6 = yLocal;
-    const AscendC::LocalTensor<float>& iter_value_6 = xLocal;
-    const AscendC::LocalTensor<float>& res_7 = yLocal;
-
-    /// vmu_ = tbe.vmuls(input_x, 1.0 / Constant.TWO_PI)
-    AscendC::Muls(vmu_, input_x, 1.0f / TWO_PI, processDataNum); // 倒数精度ok
-    /// round_fp = tbe.round(vmu_)
-    AscendC::Cast(round_fp, vmu_, AscendC::RoundMode::CAST_RINT, processDataNum);
-    /// round_fp32 = tbe.cast_to(round_fp, dtype)
-    AscendC::Cast(round_fp32, round_fp, AscendC::RoundMode::CAST_NONE, processDataNum);
-    /// input_x_round = tbe.vsub(input_x, tbe.vmuls(round_fp32, Constant.TWO_PI))
-    AscendC::Muls(t, round_fp32, TWO_PI, processDataNum);
-    AscendC::Sub(input_x_round, input_x, t, processDataNum);
-
-    /// res = tbe.broadcast(const_res, input_x.shape)
-    AscendC::Duplicate(res, 1.0f, processDataNum);
-
-    /// input_x_power = tbe.vmul(input_x_round, input_x_round)
-    AscendC::Mul(input_x_power, input_x_round, input_x_round, processDataNum);
-    /// iter_value = tbe.vmuls(input_x_power, -1.0 / 2.0)
-    AscendC::Muls(iter_value, input_x_power, REF_COEF_2, processDataNum);
-    /// res = tbe.vadd(res, iter_value)
-    AscendC::Add(res_1, res, iter_value, processDataNum);
-
-    /// iter_value = tbe.vmuls(tbe.vmul(input_x_power, iter_value), -1.0 / (i * (i - 1)))
-    AscendC::Mul(t_1, input_x_power, iter_value, processDataNum);
-    AscendC::Muls(iter_value_1, t_1, REF_COEF_4, processDataNum);
-    /// res = tbe.vadd(res, iter_value)
-    AscendC::Add(res_2, res_1, iter_value_1, processDataNum);
-
-    /// iter_value = tbe.vmuls(tbe.vmul(input_x_power, iter_value), -1.0 / (i * (i - 1)))
-    AscendC::Mul(t_2, input_x_power, iter_value_1, processDataNum);
-    AscendC::Muls(iter_value_2, t_2, REF_COEF_6, processDataNum);
-    /// res = tbe.vadd(res, iter_value)
-    AscendC::Add(res_3, res_2, iter_value_2, processDataNum);
-
-    /// iter_value = tbe.vmuls(tbe.vmul(input_x_power, iter_value), -1.0 / (i * (i - 1)))
-    AscendC::Mul(t_3, input_x_power, iter_value_2, processDataNum);
-    AscendC::Muls(iter_value_3, t_3, REF_COEF_8, processDataNum);
-    /// res = tbe.vadd(res, iter_value)
-    AscendC::Add(res_4, res_3, iter_value_3, processDataNum);
-
-    /// iter_value = tbe.vmuls(tbe.vmul(input_x_power, iter_value), -1.0 / (i * (i - 1)))
-    AscendC::Mul(t_4, input_x_power, iter_value_3, processDataNum);
-    AscendC::Muls(iter_value_4, t_4, REF_COEF_10, processDataNum);
-    /// res = tbe.vadd(res, iter_value)
-    AscendC::Add(res_5, res_4, iter_value_4, processDataNum);
-
-    /// iter_value = tbe.vmuls(tbe.vmul(input_x_power, iter_value), -1.0 / (i * (i - 1)))
-    AscendC::Mul(t_5, input_x_power, iter_value_4, processDataNum);
-    AscendC::Muls(iter_value_5, t_5, REF_COEF_12, processDataNum);
-    /// res = tbe.vadd(res, iter_value)
-    AscendC::Add(res_6, res_5, iter_value_5, processDataNum);
-
-    /// iter_value = tbe.vmuls(tbe.vmul(input_x_power, iter_value), -1.0 / (i * (i - 1)))
-    AscendC::Mul(t_6, input_x_power, iter_value_5, processDataNum);
-    AscendC::Muls(iter_value_6, t_6, REF_COEF_14, processDataNum);
-    /// res = tbe.vadd(res, iter_value)
-    AscendC::Add(res_7, res_6, iter_value_6, processDataNum);
-}
-
-class HighPerfStrategy
+template <class T, class ComputeStrategy, int32_t BUFFER_NUM, class TOut>
+__aicore__ inline uint32_t KernelCosView<T, ComputeStrategy, BUFFER_NUM, TOut>::CopyIn(uint64_t unit, uint32_t unitNum)
 {
-public:
-    __aicore__ inline HighPerfStrategy() {}
-    __aicore__ inline void InitBufImpl(AscendC::TPipe* pipe, uint32_t tileDataNum);
-    __aicore__ inline void ComputeImpl(AscendC::LocalTensor<float>& xLocal,
-                                       AscendC::LocalTensor<float>& yLocal,
-                                       uint32_t processDataNum);
+    AscendC::LocalTensor<T> xLocal = inQueueX.AllocTensor<T>();
+    AscendC::DataCopyPadExtParams<T> padParams{false, 0, 0, 0};
+    if (this->chunkNum != 1) {
+        uint64_t row = unit / this->chunkNum;
+        uint64_t col = (unit % this->chunkNum) * this->rowTileLen;
+        uint32_t processDataNum = min<uint64_t>(this->rowTileLen, this->rowLen - col);
+        AscendC::DataCopyExtParams copyParams{1, static_cast<uint32_t>(processDataNum * sizeof(T)), 0, 0, 0};
+        AscendC::DataCopyPad(xLocal, xGm[RowOffset(row) + col], copyParams, padParams);
+        inQueueX.EnQue(xLocal);
+        return (processDataNum + BLOCK_ELEM_NUM - 1) / BLOCK_ELEM_NUM * BLOCK_ELEM_NUM;
+    }
+    // one DataCopyPad per run of rows along the innermost outer dim, whose rows are evenly spaced
+    uint64_t innerShape = this->shape[this->dimNum - 1];
+    uint64_t innerStride = this->stride[this->dimNum - 1];
+    bool gapped = innerStride >= this->rowLen && (innerStride - this->rowLen) * sizeof(T) <= UINT32_MAX;
+    for (uint32_t i = 0; i < unitNum;) {
+        uint64_t row = unit + i;
+        uint32_t blockCount = 1;
+        if (gapped) {
+            blockCount = min<uint64_t>(min<uint64_t>(unitNum - i, innerShape - row % innerShape), VIEW_MAX_BLOCK_COUNT);
+        }
+        uint32_t srcGap = gapped ? static_cast<uint32_t>((innerStride - this->rowLen) * sizeof(T)) : 0;
+        AscendC::DataCopyExtParams copyParams{static_cast<uint16_t>(blockCount),
+                                              static_cast<uint32_t>(this->rowLen * sizeof(T)), srcGap,
+                                              this->xRowGap, 0};
+        uint32_t ubOffset = this->packed ? i * X_BLOCK_ELEM_NUM : i * this->rowTileAlignNum;
+        AscendC::DataCopyPad(xLocal[ubOffset], xGm[RowOffset(row)], copyParams, padParams);
+        i += blockCount;
+    }
+    inQueueX.EnQue(xLocal);
+    return this->packed ? unitNum : unitNum * this->rowTileAlignNum;
+}
 
-private:
-    AscendC::TBuf<AscendC::QuePosition::VECCALC> tmpBuf1, tmpBuf2, tmpBuf3, tmpBuf4;
-};
+template <class T, class ComputeStrategy, int32_t BUFFER_NUM, class TOut>
+__aicore__ inline void KernelCosView<T, ComputeStrategy, BUFFER_NUM, TOut>::Compute(uint32_t processDataNum)
+{
+    AscendC::LocalTensor<float> xLocal = PreDeQueCastX(processDataNum);
+    AscendC::LocalTensor<float> yLocal;
+    if constexpr (std::is_same_v<TOut, float>) {
+        yLocal = outQueueY.AllocTensor<float>();
+    } else {
+        yLocal = yBuf.Get<float>();
+    }
+    affine.PreImpl(xLocal, processDataNum);
+    strategy.ComputeImpl(xLocal, yLocal, processDataNum);
+    affine.PostImpl(yLocal, processDataNum);
+    if constexpr (std::is_same_v<T, float>) {
+        if (!this->packed) {
+            inQueueX.FreeTensor(xLocal);
+        }
+    }
+    if constexpr (std::is_same_v<TOut, float>) {
+        outQueueY.EnQue(yLocal);
+    } else {
+        AscendC::LocalTensor<TOut> yTarget = outQueueY.AllocTensor<TOut>();
+    #if __CCE_AICORE__ == 200
+        AscendC::Cast(yTarget, yLocal, AscendC::RoundMode::CAST_NONE, processDataNum);
+    #else
+        AscendC::Cast(yTarget, yLocal, AscendC::RoundMode::CAST_RINT, processDataNum);
+    #endif
+        outQueueY.EnQue(yTarget);
+    }
+}
+
+template <class T, class ComputeStrategy, int32_t BUFFER_NUM, class TOut>
+__aicore__ inline void KernelCosView<T, ComputeStrategy, BUFFER_NUM, TOut>::CopyOut(uint64_t unit, uint32_t unitNum)
+{
+    AscendC::LocalTensor<TOut> yLocal = outQueueY.DeQue<TOut>();
+    if (this->packed) {
+        // one element per row: the tile is a dense run of y
+        AscendC::DataCopyExtParams copyParams{1, static_cast<uint32_t>(unitNum * sizeof(TOut)), 0, 0, 0};
+        AscendC::DataCopyPad(yGm[unit], yLocal, copyParams);
+    } else if (this->chunkNum != 1) {
+        uint64_t col = (unit % this->chunkNum) * this->rowTileLen;
+        uint32_t processDataNum = min<uint64_t>(this->rowTileLen, this->rowLen - col);
+        uint64_t offset = unit / this->chunkNum * this->rowLen + col;
+        AscendC::DataCopyExtParams copyParams{1, static_cast<uint32_t>(processDataNum * sizeof(TOut)), 0, 0, 0};
+        AscendC::DataCopyPad(yGm[offset], yLocal, copyParams);
+    } else if (this->rowLen % BLOCK_ELEM_NUM == 0) {
+        // unpadded rows are dense in UB as in y
+        AscendC::DataCopy(yGm[unit * this->rowLen], yLocal, unitNum * this->rowTileAlignNum);
+    } else {
+        // drop the padding of every row, y is dense
+        for (uint32_t i = 0; i < unitNum; i += VIEW_MAX_BLOCK_COUNT) {
+            uint32_t blockCount = min<uint32_t>(unitNum - i, VIEW_MAX_BLOCK_COUNT);
+            AscendC::DataCopyExtParams copyParams{static_cast<uint16_t>(blockCount),
+                                                  static_cast<uint32_t>(this->rowLen * sizeof(TOut)),
+                                                  this->yRowGap, 0, 0};
+            AscendC::DataCopyPad(yGm[(unit + i) * this->rowLen], yLocal[i * this->rowTileAlignNum], copyParams);
+        }
+    }
+    outQueueY.FreeTensor(yLocal);
+}
+
+template <class T, class ComputeStrategy, int32_t BUFFER_NUM, class TOut>
+__aicore__ inline AscendC::LocalTensor<float> KernelCosView<T, ComputeStrategy, BUFFER_NUM, TOut>::PreDeQueCastX(
+    uint32_t processDataNum)
+{
+    if constexpr (std::is_same_v<T, float>) {
+        if (this->packed) {
+            return GatherPackedX(processDataNum);
+        }
+        AscendC::LocalTensor<float> xLocal = inQueueX.DeQue<float>();
+        return xLocal;
+    } else {
+        AscendC::LocalTensor<float> xLocal = xBuf.Get<float>();
+        if (this->packed) {
+            AscendC::LocalTensor<T> xPack = GatherPackedX(processDataNum);
+            AscendC::Cast(xLocal, xPack, AscendC::RoundMode::CAST_NONE, processDataNum);
+        } else {
+            AscendC::LocalTensor<T> xOrigin = inQueueX.DeQue<T>();
+            AscendC::Cast(xLocal, xOrigin, AscendC::RoundMode::CAST_NONE, processDataNum);
+            inQueueX.FreeTensor(xOrigin);
+        }
+        return xLocal;
+    }
+}
+
+// moves the first word of each 32-byte block of the x queue into a dense tile of processDataNum elements
+template <class T, class ComputeStrategy, int32_t BUFFER_NUM, class TOut>
+__aicore__ inline AscendC::LocalTensor<T> KernelCosView<T, ComputeStrategy, BUFFER_NUM, TOut>::GatherPackedX(
+    uint32_t processDataNum)
+{
+    AscendC::LocalTensor<T> xStage = inQueueX.DeQue<T>();
+    AscendC::LocalTensor<T> xPack = xPackBuf.Get<T>();
+    AscendC::LocalTensor<GatherT> packWords = xPack.template ReinterpretCast<GatherT>();
+    AscendC::LocalTensor<GatherT> stageWords = xStage.template ReinterpretCast<GatherT>();
+    AscendC::Gather(packWords, stageWords, offsetBuf.Get<uint32_t>(), 0, processDataNum);
+    inQueueX.FreeTensor(xStage);
+    return xPack;
+}
+
+template <class ComputeStrategy>
+__aicore__ inline void RunKernelCosView(GM_ADDR x, GM_ADDR y, const CosTilingData& tiling_data)
+{
+    KernelCosView<DTYPE_X, ComputeStrategy, DEFAULT_BUFFER_NUM, DTYPE_Y> op;
+    AscendC::TPipe pipe;
+    op.Init(x, y, tiling_data, &pipe);
+    op.Process();
+}
 
-__aicore__ inline void HighPerfStrategy::InitBufImpl(AscendC::TPipe* pipe, uint32_t tileDataNum)
-{
-    pipe->InitBuffer(tmpBuf1, tileDataNum * sizeof(float));
-    pipe->InitBuffer(tmpBuf2, tileDataNum * sizeof(float));
-    pipe->InitBuffer(tmpBuf3, tileDataNum * sizeof(float));
-    pipe->InitBuffer(tmpBuf4, tileDataNum * sizeof(float));
-}
-
-constexpr float PI_FOR_X_TODIV = 0.3183098733425140380859375;
-
-constexpr float PI_DOWN = 1.57079637050628662109375;
-constexpr float PI_RESDOWN_ADDS_NEG = -0.00000004371139000189375;
-
-constexpr float COS_RES_MULIT_SCA = 2.604926501e-6;
-constexpr float COS_RES_ADDICT_UP = -0.0001980894471;
-constexpr float COS_2ADDS = 0.008333049340;
-constexpr float COS_3ADDS = -0.1666665792;
-
-constexpr float pi_0 = 3.14160156;
-constexpr float pi_1 = -8.9071691e-06;
-constexpr float pi_2 = -1.74122761e-09;
-constexpr float pi_3 = 1.24467439e-13;
-
-__aicore__ inline void HighPerfStrategy::ComputeImpl(AscendC::LocalTensor<float>& xLocal,
-                                                     AscendC::LocalTensor<float>& yLocal,
-                                                     uint32_t processDataNum)
-{
-    AscendC::LocalTensor<float> tmpTensor1 = tmpBuf1.Get<float>();
-    AscendC::LocalTensor<float> tmpTensor2 = tmpBuf2.Get<float>();
-    AscendC::LocalTensor<float> tmpTensor3 = tmpBuf3.Get<float>();
-    AscendC::LocalTensor<float> tmpTensor4 = tmpBuf4.Get<float>();
-
-    const AscendC::LocalTensor<float>& input_x = xLocal;
-    const AscendC::LocalTensor<float>& x_vmul = tmpTensor1;
-    const AscendC::LocalTensor<float>& x_vmul1 = tmpTensor2;
-    const AscendC::LocalTensor<float>& x_vmul0 = yLocal;
-    const AscendC::LocalTensor<float>& round_pi_div = tmpTensor1;
-    const AscendC::LocalTensor<float>& round_pi_div0 = tmpTensor3;
-    const AscendC::LocalTensor<float>& round_pi_div0_1 = tmpTensor2;
-    const AscendC::LocalTensor<float>& round_pi_div1 = yLocal;
-    const AscendC::LocalTensor<float>& fix = tmpTensor4;
-    const AscendC::LocalTensor<float>& x_fixed = tmpTensor3;
-    const AscendC::LocalTensor<float>& fix_1 = tmpTensor4;
-    const AscendC::LocalTensor<float>& x_fixed_1 = xLocal;
-    const AscendC::LocalTensor<float>& fix_2 = tmpTensor4;
-    const AscendC::LocalTensor<float>& x_fixed_2 = tmpTensor3;
-    const AscendC::LocalTensor<float>& x_fixed_3 = xLocal;
-    const AscendC::LocalTensor<float>& fix_3 = tmpTensor4;
-    const AscendC::LocalTensor<float>& x_fixed_4 = tmpTensor3;
-    const AscendC::LocalTensor<float>& fix_4 = tmpTensor4;
-    const AscendC::LocalTensor<float>& x_fixed_5 = xLocal;
-    const AscendC::LocalTensor<float>& fix_5 = tmpTensor4;
-    const AscendC::LocalTensor<float>& x_fixed_6 = tmpTensor3;
-    const AscendC::LocalTensor<float>& fix_6 = xLocal;
-    const AscendC::LocalTensor<float>& x_fixed_7 = tmpTensor2;
-    const AscendC::LocalTensor<float>& fix_7 = xLocal;
-    const AscendC::LocalTensor<float>& x_fixed_8 = tmpTensor3;
-    const AscendC::LocalTensor<float>& x_fixed_9 = yLocal;
-    const AscendC::LocalTensor<float>& x_pow = tmpTensor2;
-    const AscendC::LocalTensor<float>& kover2 = xLocal;
-    const AscendC::LocalTensor<float>& kover2floor = tmpTensor3;
-    const AscendC::LocalTensor<float>& kover2floorm4 = xLocal;
-    const AscendC::LocalTensor<float>& k2 = tmpTensor3;
-    const AscendC::LocalTensor<float>& sign = tmpTensor4;
-    const AscendC::LocalTensor<float>& sign_1 = tmpTensor1;
-    const AscendC::LocalTensor<float>& res_up = tmpTensor3;
-    const AscendC::LocalTensor<float>& res_up_1 = xLocal;
-    const AscendC::LocalTensor<float>& res_up_2 = tmpTensor3;
-    const AscendC::LocalTensor<float>& res_up_3 = xLocal;
-    const AscendC::LocalTensor<float>& res_up_4 = tmpTensor3;
-    const AscendC::LocalTensor<float>& res_up_5 = xLocal;
-    const AscendC::LocalTensor<float>& res_up_6 = tmpTensor3;
-    const AscendC::LocalTensor<float>& res_up_7 = tmpTensor2;
-    const AscendC::LocalTensor<float>& res_up_8 = xLocal;
-    const AscendC::LocalTensor<float>& res_sign = yLocal;
-    const AscendC::LocalTensor<float>& res_mins = tmpTensor1;
-    const AscendC::LocalTensor<float>& res_maxs = yLocal;
-
-    /// x_vmul = tbe.vmuls(input_x, tvm.const(Constant.PI_FOR_X_TODIV, dtype=dtype))
-    AscendC::Muls(x_vmul, input_x, PI_FOR_X_TODIV, processDataNum);
-    /// x_vmul1 = tbe.vadds(x_vmul, tvm.const(0.5, dtype=dtype))
-    AscendC::Adds(x_vmul1, x_vmul, 0.5f, processDataNum);
-    /// x_vmul0 = tbe.vmuls(x_vmul, tvm.const(Constant.ONE_OVER_2048, dtype=dtype))
-    AscendC::Muls(x_vmul0, x_vmul, 1.0f / 2048.0f, processDataNum);
-    /// round_pi_div = tbe.round_half_up(x_vmul1, "float32")
-    AscendC::Cast(round_pi_div, x_vmul1, AscendC::RoundMode::CAST_ROUND, processDataNum);
-    /// round_pi_div0 = tbe.round_half_up(x_vmul0, "float32")
-    AscendC::Cast(round_pi_div0, x_vmul0, AscendC::RoundMode::CAST_ROUND, processDataNum);
-    /// round_pi_div0 = tbe.vmuls(round_pi_div0, tvm.const(2048.0, dtype=dtype))
-    AscendC::Muls(round_pi_div0_1, round_pi_div0, 2048.0f, processDataNum);
-    /// round_pi_div1 = tbe.vsub(round_pi_div, round_pi_div0)
-    AscendC::Sub(round_pi_div1, round_pi_div, round_pi_div0_1, processDataNum);
-
-    /// fix = tbe.vmuls(round_pi_div0, tvm.const(Constant.pi_0, dtype=dtype))
-    AscendC::Muls(fix, round_pi_div0_1, pi_0, processDataNum);
-    /// x_fixed = tbe.vsub(input_x, fix)
-    AscendC::Sub(x_fixed, input_x, fix, processDataNum);
-    /// fix = tbe.vmuls(round_pi_div1, tvm.const(Constant.pi_0, dtype=dtype))
-    AscendC::Muls(fix_1, round_pi_div1, pi_0, processDataNum);
-    /// x_fixed = tbe.vsub(x_fixed, fix)
-    AscendC::Sub(x_fixed_1, x_fixed, fix_1, processDataNum);
-    /// fix = tbe.vmuls(round_pi_div0, tvm.const(Constant.pi_1, dtype=dtype))
-    AscendC::Muls(fix_2, round_pi_div0_1, pi_1, processDataNum);
-    /// x_fixed = tbe.vsub(x_fixed, fix)
-    AscendC::Sub(x_fixed_2, x_fixed_1, fix_2, processDataNum);
-
-    /// x_fixed = tbe.vadds(x_fixed, tvm.const(Constant.PI_DOWN, dtype=dtype))
-    AscendC::Adds(x_fixed_3, x_fixed_2, PI_DOWN, processDataNum);
-
-    /// fix = tbe.vmuls(round_pi_div1, tvm.const(Constant.pi_1, dtype=dtype))
-    AscendC::Muls(fix_3, round_pi_div1, pi_1, processDataNum);
-    /// x_fixed = tbe.vsub(x_fixed, fix)
-    AscendC::Sub(x_fixed_4, x_fixed_3, fix_3, processDataNum);
-    /// fix = tbe.vmuls(round_pi_div0, tvm.const(Constant.pi_2, dtype=dtype))
-    AscendC::Muls(fix_4, round_pi_div0_1, pi_2, processDataNum);
-    /// x_fixed = tbe.vsub(x_fixed, fix)
-    AscendC::Sub(x_fixed_5, x_fixed_4, fix_4, processDataNum);
-    /// fix = tbe.vmuls(round_pi_div1, tvm.const(Constant.pi_2, dtype=dtype))
-    AscendC::Muls(fix_5, round_pi_div1, pi_2, processDataNum);
-    /// x_fixed = tbe.vsub(x_fixed, fix)
-    AscendC::Sub(x_fixed_6, x_fixed_5, fix_5, processDataNum);
-    /// fix = tbe.vmuls(round_pi_div0, tvm.const(Constant.pi_3, dtype=dtype))
-    AscendC::Muls(fix_6, round_pi_div0_1, pi_3, processDataNum);
-    /// x_fixed = tbe.vsub(x_fixed, fix)
-    AscendC::Sub(x_fixed_7, x_fixed_6, fix_6, processDataNum);
-    /// fix = tbe.vmuls(round_pi_div1, tvm.const(Constant.pi_3, dtype=dtype))
-    AscendC::Muls(fix_7, round_pi_div1, pi_3, processDataNum);
-    /// x_fixed = tbe.vsub(x_fixed, fix)
-    AscendC::Sub(x_fixed_8, x_fixed_7, fix_7, processDataNum);
-    /// x_fixed = tbe.vadds(x_fixed, tvm.const(Constant.PI_RESDOWN_ADDS_NEG, dtype=dtype))
-    AscendC::Adds(x_fixed_9, x_fixed_8, PI_RESDOWN_ADDS_NEG, processDataNum);
-
-    /// x_pow = tbe.vmul(x_fixed, x_fixed)
-    AscendC::Mul(x_pow, x_fixed_9, x_fixed_9, processDataNum);
-    /// kover2 = tbe.vmuls(round_pi_div, tvm.const(0.5, dtype=dtype))
-    AscendC::Muls(kover2, round_pi_div, 0.5f, processDataNum);
-    /// kover2floor = tbe.floor(kover2, "float32")
-    AscendC::Cast(kover2floor, kover2, AscendC::RoundMode::CAST_FLOOR, processDataNum);
-    /// kover2floorm4 = tbe.vmuls(kover2floor, tvm.const(4.0, dtype=dtype))
-    AscendC::Muls(kover2floorm4, kover2floor, 4.0f, processDataNum);
-    /// k2 = tbe.vmuls(round_pi_div, tvm.const(-2.0, dtype=dtype))
-    AscendC::Muls(k2, round_pi_div, -2.0f, processDataNum);
-    /// sign = tbe.vadd(kover2floorm4, k2)
-    AscendC::Add(sign, kover2floorm4, k2, processDataNum);
-    /// sign = tbe.vadds(sign, tvm.const(1.0, dtype=dtype))
-    AscendC::Adds(sign_1, sign, 1.0f, processDataNum);
-
-    /// res_up = tbe.vmuls(x_pow, tvm.const(Constant.COS_RES_MULIT_SCA, dtype=dtype))
-    AscendC::Muls(res_up, x_pow, COS_RES_MULIT_SCA, processDataNum);
-    /// res_up = tbe.vadds(res_up, tvm.const(Constant.COS_RES_ADDICT_UP, dtype=dtype))
-    AscendC::Adds(res_up_1, res_up, COS_RES_ADDICT_UP, processDataNum);
-    /// res_up = tbe.vmul(res_up, x_pow)
-    AscendC::Mul(res_up_2, res_up_1, x_pow, processDataNum);
-    /// res_up = tbe.vadds(res_up, tvm.const(Constant.COS_2ADDS, dtype=dtype))
-    AscendC::Adds(res_up_3, res_up_2, COS_2ADDS, processDataNum);
-    /// res_up = tbe.vmul(res_up, x_pow)
-    AscendC::Mul(res_up_4, res_up_3, x_pow, processDataNum);
-    /// res_up = tbe.vadds(res_up, tvm.const(Constant.COS_3ADDS, dtype=dtype))
-    AscendC::Adds(res_up_5, res_up_4, COS_3ADDS, processDataNum);
-    /// res_up = tbe.vmul(res_up, x_pow)
-    AscendC::Mul(res_up_6, res_up_5, x_pow, processDataNum);
-    /// res_up = tbe.vadds(res_up, tvm.const(1.0, dtype=dtype))
-    AscendC::Adds(res_up_7, res_up_6, 1.0f, processDataNum);
-    /// res_up = tbe.vmul(res_up, x_fixed)
-    AscendC::Mul(res_up_8, res_up_7, x_fixed_9, processDataNum);
-    /// res_sign = tbe.vmul(res_up, sign)
-    AscendC::Mul(res_sign, res_up_8, sign_1, processDataNum);
-
-    /// res_mins = tbe.vmins(res_sign, tvm.const(Constant.NUMBER_POS_ONE, dtype=dtype))
-    AscendC::Mins(res_mins, res_sign, 1.0f, processDataNum);
-    /// res_maxs = tbe.vmaxs(res_mins, tvm.const(Constant.NUMBER_NEG_ONE, dtype=dtype))
-    AscendC::Maxs(res_maxs, res_mins, -1.0f, processDataNum);
-}
-
-class HighPrecStrategy
+// fp16 only: tiles whose max |x| is within HALF_MAX_ABS run HalfStrategy on the half input as it is, the
+// others are widened to fp32 and run FallbackStrategy like KernelCos. The two never share a tile, so the
+// half scratch of HalfStrategy sits next to the float buffers of the fallback
+template <class FallbackStrategy, int32_t BUFFER_NUM = DEFAULT_BUFFER_NUM>
+class KernelCosHalf
 {
 public:
-    __aicore__ inline HighPrecStrategy() {}
-    __aicore__ inline void InitBufImpl(AscendC::TPipe* pipe, uint32_t tileDataNum);
-    __aicore__ inline void ComputeImpl(AscendC::LocalTensor<float>& xLocal,
-                                       AscendC::LocalTensor<float>& yLocal,
-                                       uint32_t processDataNum);
+    __aicore__ inline KernelCosHalf() {}
+    __aicore__ inline void Init(GM_ADDR x, GM_ADDR y,
+                                uint64_t bigCoreDataNum,
+                                uint64_t smallCoreDataNum,
+                                uint64_t tailCoreDataNum,
+                                uint32_t tileDataNum,
+                                uint32_t bigCoreNum,
+                                AscendC::TPipe* pipe);
+    __aicore__ inline void Process();
+
+private:
+    template <class U>
+    static __aicore__ inline const U& min(const U& a, const U& b) { return (b < a) ? b : a; }
+
+    __aicore__ inline void CopyIn(uint64_t offset, uint32_t processDataNum);
+    __aicore__ inline bool WithinHalfRange(AscendC::LocalTensor<half>& xLocal, uint32_t processDataNum);
+    __aicore__ inline void Compute(uint32_t processDataNum);
+    __aicore__ inline void CopyOut(uint64_t offset, uint32_t processDataNum);
 
 private:
-    AscendC::TBuf<AscendC::QuePosition::VECCALC> tmpBuf1, tmpBuf2, tmpBuf3, tmpBuf4;
+    AscendC::TQue<AscendC::QuePosition::VECIN, 1> inQueueX;
+    AscendC::TQue<AscendC::QuePosition::VECOUT, 1> outQueueY;
+    AscendC::TBuf<AscendC::QuePosition::VECCALC> xBuf, yBuf;
+    AscendC::GlobalTensor<half> xGm;
+    AscendC::GlobalTensor<half> yGm;
+
+    uint64_t coreDataNum;
+    uint32_t tileDataNum;
+
+    HalfStrategy halfStrategy;
+    FallbackStrategy strategy;
+
+    static constexpr uint32_t BLOCK_ELEM_NUM = 32 / sizeof(half);
 };
 
-__aicore__ inline void HighPrecStrategy::InitBufImpl(AscendC::TPipe* pipe, uint32_t tileDataNum)
-{
-    pipe->InitBuffer(tmpBuf1, tileDataNum * sizeof(float));
-    pipe->InitBuffer(tmpBuf2, tileDataNum * sizeof(float));
-    pipe->InitBuffer(tmpBuf3, tileDataNum * sizeof(float));
-    pipe->InitBuffer(tmpBuf4, tileDataNum * sizeof(float));
-}
-
-constexpr float PI_V4_0 = 1.5708008;
-constexpr float PI_V4_1 = -0.0000044535846;
-constexpr float PI_V4_2 = -8.706138e-10;
-constexpr float PI_V4_3 = 1.5703125;
-constexpr float PI_12 = 0.0004837513;
-constexpr float PI_22 = 0.000000075495336;
-constexpr float PI_32 = 2.5579538e-12;
-constexpr float PI_42 = 5.389786e-15;
-constexpr float PI_52 = 5.166901e-19;
-constexpr float PI_62 = 3.281839e-22;
-
-constexpr float INV_HALF_PI = 0.63661975;
-
-constexpr float SCOEF_4 = 0.0000027183114939898219064;
-constexpr float SCOEF_3 = -0.000198393348360966317347;
-constexpr float SCOEF_2 = 0.0083333293858894631756;
-constexpr float SCOEF_1 = -0.166666666416265235595;
-
-constexpr float CCOEF_4 = 0.0000243904487962774090654;
-constexpr float CCOEF_3 = -0.00138867637746099294692;
-constexpr float CCOEF_2 = 0.0416666233237390631894;
-constexpr float CCOEF_1 = -0.499999997251031003120;
-
-__aicore__ inline void HighPrecStrategy::ComputeImpl(AscendC::LocalTensor<float>& xLocal,
-                                                     AscendC::LocalTensor<float>& yLocal,
-                                                     uint32_t processDataNum)
-{
-    AscendC::LocalTensor<float> tmpTensor1 = tmpBuf1.Get<float>();
-    AscendC::LocalTensor<float> tmpTensor2 = tmpBuf2.Get<float>();
-    AscendC::LocalTensor<float> tmpTensor3 = tmpBuf3.Get<float>();
-    AscendC::LocalTensor<float> tmpTensor4 = tmpBuf4.Get<float>();
-
-    const AscendC::LocalTensor<float>& input_x = xLocal;
-    const AscendC::LocalTensor<float>& x_scaled = tmpTensor1;
-    const AscendC::LocalTensor<float>& x_overpi = tmpTensor3;
-    const AscendC::LocalTensor<float>& n = tmpTensor2;
-    const AscendC::LocalTensor<float>& n0 = yLocal;
-    const AscendC::LocalTensor<float>& n0_1 = tmpTensor3;
-    const AscendC::LocalTensor<float>& n0_2 = yLocal;
-    const AscendC::LocalTensor<float>& n1 = tmpTensor3;
-    const AscendC::LocalTensor<float>& fix = tmpTensor4;
-    const AscendC::LocalTensor<float>& x_fix = tmpTensor2;
-    const AscendC::LocalTensor<float>& fix_1 = tmpTensor4;
-    const AscendC::LocalTensor<float>& x_fix_1 = tmpTensor1;
-    const AscendC::LocalTensor<float>& fix_2 = tmpTensor4;
-    const AscendC::LocalTensor<float>& x_fix_2 = tmpTensor2;
-    const AscendC::LocalTensor<float>& fix_3 = tmpTensor4;
-    const AscendC::LocalTensor<float>& x_fix_3 = tmpTensor1;
-    const AscendC::LocalTensor<float>& fix_4 = tmpTensor4;
-    const AscendC::LocalTensor<float>& x_fix_4 = tmpTensor2;
-    const AscendC::LocalTensor<float>& remain_x = tmpTensor1;
-    const AscendC::LocalTensor<float>& temp = tmpTensor2;
-    const AscendC::LocalTensor<float>& n2 = tmpTensor1;
-    const AscendC::LocalTensor<float>& n0_3 = tmpTensor2;
-    const AscendC::LocalTensor<float>& n1_1 = yLocal;
-    const AscendC::LocalTensor<float>& fix_5 = tmpTensor4;
-    const AscendC::LocalTensor<float>& x_fix_5 = tmpTensor3;
-    const AscendC::LocalTensor<float>& fix_6 = tmpTensor4;
-    const AscendC::LocalTensor<float>& x_fix_6 = xLocal;
-    const AscendC::LocalTensor<float>& fix_7 = tmpTensor4;
-    const AscendC::LocalTensor<float>& x_fix_7 = tmpTensor3;
-    const AscendC::LocalTensor<float>& fix_8 = tmpTensor4;
-    const AscendC::LocalTensor<float>& x_fix_8 = xLocal;
-    const AscendC::LocalTensor<float>& fix_9 = tmpTensor4;
-    const AscendC::LocalTensor<float>& x_fix_9 = tmpTensor3;
-    const AscendC::LocalTensor<float>& fix_10 = tmpTensor4;
-    const AscendC::LocalTensor<float>& x_fix_10 = xLocal;
-    const AscendC::LocalTensor<float>& fix_11 = tmpTensor4;
-    const AscendC::LocalTensor<float>& x_fix_11 = tmpTensor3;
-    const AscendC::LocalTensor<float>& fix_12 = tmpTensor4;
-    const AscendC::LocalTensor<float>& x_fix_12 = xLocal;
-    const AscendC::LocalTensor<float>& fix_13 = tmpTensor4;
-    const AscendC::LocalTensor<float>& x_fix_13 = tmpTensor3;
-    const AscendC::LocalTensor<float>& fix_14 = tmpTensor4;
-    const AscendC::LocalTensor<float>& x_fix_14 = xLocal;
-    const AscendC::LocalTensor<float>& fix_15 = tmpTensor4;
-    const AscendC::LocalTensor<float>& x_fix_15 = tmpTensor3;
-    const AscendC::LocalTensor<float>& fix_16 = tmpTensor4;
-    const AscendC::LocalTensor<float>& x_fix_16 = xLocal;
-    const AscendC::LocalTensor<float>& fix_17 = tmpTensor4;
-    const AscendC::LocalTensor<float>& x_fix_17 = tmpTensor3;
-    const AscendC::LocalTensor<float>& fix_18 = tmpTensor4;
-    const AscendC::LocalTensor<float>& x_fix_18 = xLocal;
-    const AscendC::LocalTensor<float>& fix_19 = tmpTensor4;
-    const AscendC::LocalTensor<float>& x_fix_19 = tmpTensor3;
-    const AscendC::LocalTensor<float>& fix_20 = tmpTensor4;
-    const AscendC::LocalTensor<float>& x_fix_20 = xLocal;
-    const AscendC::LocalTensor<float>& fix_21 = tmpTensor4;
-    const AscendC::LocalTensor<float>& x_fix_21 = tmpTensor3;
-    const AscendC::LocalTensor<float>& fix_22 = xLocal;
-    const AscendC::LocalTensor<float>& x_fix_22 = tmpTensor2;
-    const AscendC::LocalTensor<float>& fix_23 = tmpTensor3;
-    const AscendC::LocalTensor<float>& x_fix_23 = xLocal;
-    const AscendC::LocalTensor<float>& fix_24 = tmpTensor2;
-    const AscendC::LocalTensor<float>& x_fix_24 = yLocal;
-    const AscendC::LocalTensor<float>& fix_25 = tmpTensor2;
-    const AscendC::LocalTensor<float>& x_fix_25 = xLocal;
-    const AscendC::LocalTensor<float>& x_pow = tmpTensor2;
-    const AscendC::LocalTensor<float>& sin_poly = tmpTensor3;
-    const AscendC::LocalTensor<float>& sin_poly_1 = yLocal;
-    const AscendC::LocalTensor<float>& sin_poly_2 = tmpTensor3;
-    const AscendC::LocalTensor<float>& sin_poly_3 = yLocal;
-    const AscendC::LocalTensor<float>& sin_poly_4 = tmpTensor3;
-    const AscendC::LocalTensor<float>& sin_poly_5 = yLocal;
-    const AscendC::LocalTensor<float>& sin_poly_6 = tmpTensor3;
-    const AscendC::LocalTensor<float>& sin_poly_7 = tmpTensor4;
-    const AscendC::LocalTensor<float>& sin_poly_8 = yLocal;
-    const AscendC::LocalTensor<float>& cos_poly = tmpTensor3;
-    const AscendC::LocalTensor<float>& cos_poly_1 = xLocal;
-    const AscendC::LocalTensor<float>& cos_poly_2 = tmpTensor3;
-    const AscendC::LocalTensor<float>& cos_poly_3 = xLocal;
-    const AscendC::LocalTensor<float>& cos_poly_4 = tmpTensor3;
-    const AscendC::LocalTensor<float>& cos_poly_5 = xLocal;
-    const AscendC::LocalTensor<float>& cos_poly_6 = tmpTensor3;
-    const AscendC::LocalTensor<float>& cos_poly_7 = tmpTensor2;
-    const AscendC::LocalTensor<float>& n2_1 = xLocal;
-    const AscendC::LocalTensor<float>& half_n2 = tmpTensor4;
-    const AscendC::LocalTensor<float>& half4_n2 = tmpTensor3;
-    const AscendC::LocalTensor<float>& n_half2 = tmpTensor1;
-    const AscendC::LocalTensor<float>& n_half4 = tmpTensor4;
-    const AscendC::LocalTensor<float>& k1 = tmpTensor3;
-    const AscendC::LocalTensor<float>& k2 = tmpTensor1;
-    const AscendC::LocalTensor<float>& sign = tmpTensor4;
-    const AscendC::LocalTensor<float>& sign_1 = tmpTensor1;
-    const AscendC::LocalTensor<float>& ifcos = tmpTensor4;
-    const AscendC::LocalTensor<float>& ifsin = xLocal;
-    const AscendC::LocalTensor<float>& ifsin_1 = tmpTensor3;
-    const AscendC::LocalTensor<float>& temp1 = xLocal;
-    const AscendC::LocalTensor<float>& cos_poly_8 = yLocal;
-    const AscendC::LocalTensor<float>& res = tmpTensor2;
-    const AscendC::LocalTensor<float>& res_1 = yLocal;
-
-    /// x_scaled = tbe.vmuls(input_x, one_over_n)
-    AscendC::Muls(x_scaled, input_x, 1.0f / 2048.0f, processDataNum);
-    /// x_overpi = tbe.vmuls(x_scaled, inv_half_pi)
-    AscendC::Muls(x_overpi, x_scaled, INV_HALF_PI, processDataNum);
-    /// n = tbe.round(x_overpi, "float32")
-    AscendC::Cast(n, x_overpi, AscendC::RoundMode::CAST_RINT, processDataNum);
-
-    /// n0 = tbe.vmuls(x_overpi, one_over_n)
-    AscendC::Muls(n0, x_overpi, 1.0f / 2048.0f, processDataNum);
-    /// n0 = tbe.round(n0, "float32")
-    AscendC::Cast(n0_1, n0, AscendC::RoundMode::CAST_RINT, processDataNum);
-    /// n0 = tbe.vmuls(n0, number_2048)
-    AscendC::Muls(n0_2, n0_1, 2048.0f, processDataNum);
-    /// n1 = tbe.vsub(n, n0)
-    AscendC::Sub(n1, n, n0_2, processDataNum);
-
-    /// fix = tbe.vmuls(n0, pi_0)
-    AscendC::Muls(fix, n0_2, PI_V4_0, processDataNum);
-    /// x_fix = tbe.vsub(x_scaled, fix)
-    AscendC::Sub(x_fix, x_scaled, fix, processDataNum);
-    /// fix = tbe.vmuls(n1, pi_0)
-    AscendC::Muls(fix_1, n1, PI_V4_0, processDataNum);
-    /// x_fix = tbe.vsub(x_fix, fix)
-    AscendC::Sub(x_fix_1, x_fix, fix_1, processDataNum);
-    /// fix = tbe.vmuls(n0, pi_1)
-    AscendC::Muls(fix_2, n0_2, PI_V4_1, processDataNum);
-    /// x_fix = tbe.vsub(x_fix, fix)
-    AscendC::Sub(x_fix_2, x_fix_1, fix_2, processDataNum);
-    /// fix = tbe.vmuls(n1, pi_1)
-    AscendC::Muls(fix_3, n1, PI_V4_1, processDataNum);
-    /// x_fix = tbe.vsub(x_fix, fix)
-    AscendC::Sub(x_fix_3, x_fix_2, fix_3, processDataNum);
-    /// fix = tbe.vmuls(n0, pi_2)
-    AscendC::Muls(fix_4, n0_2, PI_V4_2, processDataNum);
-    /// x_fix = tbe.vsub(x_fix, fix)
-    AscendC::Sub(x_fix_4, x_fix_3, fix_4, processDataNum);
-
-    /// remain_x = tbe.vmuls(x_fix, number_2048)
-    AscendC::Muls(remain_x, x_fix_4, 2048.0f, processDataNum);
-    /// temp = tbe.vmuls(remain_x, inv_half_pi)
-    AscendC::Muls(temp, remain_x, INV_HALF_PI, processDataNum);
-    /// n2 = tbe.round(temp, "float32")
-    AscendC::Cast(n2, temp, AscendC::RoundMode::CAST_RINT, processDataNum);
-    /// n0 = tbe.vmuls(n0, number_2048)
-    AscendC::Muls(n0_3, n0_2, 2048.0f, processDataNum);
-    /// n1 = tbe.vmuls(n1, number_2048)
-    AscendC::Muls(n1_1, n1, 2048.0f, processDataNum);
-    /// fix = tbe.vmuls(n0, pi_02)
-    AscendC::Muls(fix_5, n0_3, PI_V4_3, processDataNum);
-    /// x_fix = tbe.vsub(input_x, fix)
-    AscendC::Sub(x_fix_5, input_x, fix_5, processDataNum);
-    /// fix = tbe.vmuls(n1, pi_02)
-    AscendC::Muls(fix_6, n1_1, PI_V4_3, processDataNum);
-    /// x_fix = tbe.vsub(x_fix, fix)
-    AscendC::Sub(x_fix_6, x_fix_5, fix_6, processDataNum);
-    /// fix = tbe.vmuls(n0, pi_12)
-    AscendC::Muls(fix_7, n0_3, PI_12, processDataNum);
-    /// x_fix = tbe.vsub(x_fix, fix)
-    AscendC::Sub(x_fix_7, x_fix_6, fix_7, processDataNum);
-
-    /// fix = tbe.vmuls(n2, pi_02)
-    AscendC::Muls(fix_8, n2, PI_V4_3, processDataNum);
-    /// x_fix = tbe.vsub(x_fix, fix)
-    AscendC::Sub(x_fix_8, x_fix_7, fix_8, processDataNum);
-    /// fix = tbe.vmuls(n1, pi_12)
-    AscendC::Muls(fix_9, n1_1, PI_12, processDataNum);
-    /// x_fix = tbe.vsub(x_fix, fix)
-    AscendC::Sub(x_fix_9, x_fix_8, fix_9, processDataNum);
-    /// fix = tbe.vmuls(n0, pi_22)
-    AscendC::Muls(fix_10, n0_3, PI_22, processDataNum);
-    /// x_fix = tbe.vsub(x_fix, fix)
-    AscendC::Sub(x_fix_10, x_fix_9, fix_10, processDataNum);
-
-    /// fix = tbe.vmuls(n2, pi_12)
-    AscendC::Muls(fix_11, n2, PI_12, processDataNum);
-    /// x_fix = tbe.vsub(x_fix, fix)
-    AscendC::Sub(x_fix_11, x_fix_10, fix_11, processDataNum);
-    /// fix = tbe.vmuls(n1, pi_22)
-    AscendC::Muls(fix_12, n1_1, PI_22, processDataNum);
-    /// x_fix = tbe.vsub(x_fix, fix)
-    AscendC::Sub(x_fix_12, x_fix_11, fix_12, processDataNum);
-    /// fix = tbe.vmuls(n0, pi_32)
-    AscendC::Muls(fix_13, n0_3, PI_32, processDataNum);
-    /// x_fix = tbe.vsub(x_fix, fix)
-    AscendC::Sub(x_fix_13, x_fix_12, fix_13, processDataNum);
-
-    /// fix = tbe.vmuls(n2, pi_22)
-    AscendC::Muls(fix_14, n2, PI_22, processDataNum);
-    /// x_fix = tbe.vsub(x_fix, fix)
-    AscendC::Sub(x_fix_14, x_fix_13, fix_14, processDataNum);
-    /// fix = tbe.vmuls(n1, pi_32)
-    AscendC::Muls(fix_15, n1_1, PI_32, processDataNum);
-    /// x_fix = tbe.vsub(x_fix, fix)
-    AscendC::Sub(x_fix_15, x_fix_14, fix_15, processDataNum);
-    /// fix = tbe.vmuls(n0, pi_42)
-    AscendC::Muls(fix_16, n0_3, PI_42, processDataNum);
-    /// x_fix = tbe.vsub(x_fix, fix)
-    AscendC::Sub(x_fix_16, x_fix_15, fix_16, processDataNum);
-
-    /// fix = tbe.vmuls(n2, pi_32)
-    AscendC::Muls(fix_17, n2, PI_32, processDataNum);
-    /// x_fix = tbe.vsub(x_fix, fix)
-    AscendC::Sub(x_fix_17, x_fix_16, fix_17, processDataNum);
-    /// fix = tbe.vmuls(n1, pi_42)
-    AscendC::Muls(fix_18, n1_1, PI_42, processDataNum);
-    /// x_fix = tbe.vsub(x_fix, fix)
-    AscendC::Sub(x_fix_18, x_fix_17, fix_18, processDataNum);
-    /// fix = tbe.vmuls(n0, pi_52)
-    AscendC::Muls(fix_19, n0_3, PI_52, processDataNum);
-    /// x_fix = tbe.vsub(x_fix, fix)
-    AscendC::Sub(x_fix_19, x_fix_18, fix_19, processDataNum);
-
-    /// fix = tbe.vmuls(n2, pi_42)
-    AscendC::Muls(fix_20, n2, PI_42, processDataNum);
-    /// x_fix = tbe.vsub(x_fix, fix)
-    AscendC::Sub(x_fix_20, x_fix_19, fix_20, processDataNum);
-    /// fix = tbe.vmuls(n1, pi_52)
-    AscendC::Muls(fix_21, n1_1, PI_52, processDataNum);
-    /// x_fix = tbe.vsub(x_fix, fix)
-    AscendC::Sub(x_fix_21, x_fix_20, fix_21, processDataNum);
-    /// fix = tbe.vmuls(n0, pi_62)
-    AscendC::Muls(fix_22, n0_3, PI_62, processDataNum);
-    /// x_fix = tbe.vsub(x_fix, fix)
-    AscendC::Sub(x_fix_22, x_fix_21, fix_22, processDataNum);
-
-    /// fix = tbe.vmuls(n2, pi_52)
-    AscendC::Muls(fix_23, n2, PI_52, processDataNum);
-    /// x_fix = tbe.vsub(x_fix, fix)
-    AscendC::Sub(x_fix_23, x_fix_22, fix_23, processDataNum);
-    /// fix = tbe.vmuls(n1, pi_62)
-    AscendC::Muls(fix_24, n1_1, PI_62, processDataNum);
-    /// x_fix = tbe.vsub(x_fix, fix)
-    AscendC::Sub(x_fix_24, x_fix_23, fix_24, processDataNum);
-    /// fix = tbe.vmuls(n2, pi_62)
-    AscendC::Muls(fix_25, n2, PI_62, processDataNum);
-    /// x_fix = tbe.vsub(x_fix, fix)
-    AscendC::Sub(x_fix_25, x_fix_24, fix_25, processDataNum);
-
-    /// x_pow = tbe.vmul(x_fix, x_fix)
-    AscendC::Mul(x_pow, x_fix_25, x_fix_25, processDataNum);
-    /// sin_poly = tbe.vmuls(x_pow, scoef4)
-    AscendC::Muls(sin_poly, x_pow, SCOEF_4, processDataNum);
-    /// sin_poly = tbe.vadds(sin_poly, scoef3)
-    AscendC::Adds(sin_poly_1, sin_poly, SCOEF_3, processDataNum);
-    /// sin_poly = tbe.vmul(x_pow, sin_poly)
-    AscendC::Mul(sin_poly_2, x_pow, sin_poly_1, processDataNum);
-    /// sin_poly = tbe.vadds(sin_poly, scoef2)
-    AscendC::Adds(sin_poly_3, sin_poly_2, SCOEF_2, processDataNum);
-    /// sin_poly = tbe.vmul(x_pow, sin_poly)
-    AscendC::Mul(sin_poly_4, x_pow, sin_poly_3, processDataNum);
-    /// sin_poly = tbe.vadds(sin_poly, scoef1)
-    AscendC::Adds(sin_poly_5, sin_poly_4, SCOEF_1, processDataNum);
-    /// sin_poly = tbe.vmul(x_pow, sin_poly)
-    AscendC::Mul(sin_poly_6, x_pow, sin_poly_5, processDataNum);
-    /// sin_poly = tbe.vadds(sin_poly, tvm.const(1.0, dtype=dtype))
-    AscendC::Adds(sin_poly_7, sin_poly_6, 1.0f, processDataNum);
-    /// sin_poly = tbe.vmul(x_fix, sin_poly)
-    AscendC::Mul(sin_poly_8, x_fix_25, sin_poly_7, processDataNum);
-
-    /// cos_poly = tbe.vmuls(x_pow, ccoef4)
-    AscendC::Muls(cos_poly, x_pow, CCOEF_4, processDataNum);
-    /// cos_poly = tbe.vadds(cos_poly, ccoef3)
-    AscendC::Adds(cos_poly_1, cos_poly, CCOEF_3, processDataNum);
-    /// cos_poly = tbe.vmul(x_pow, cos_poly)
-    AscendC::Mul(cos_poly_2, x_pow, cos_poly_1, processDataNum);
-    /// cos_poly = tbe.vadds(cos_poly, ccoef2)
-    AscendC::Adds(cos_poly_3, cos_poly_2, CCOEF_2, processDataNum);
-    /// cos_poly = tbe.vmul(x_pow, cos_poly)
-    AscendC::Mul(cos_poly_4, x_pow, cos_poly_3, processDataNum);
-    /// cos_poly = tbe.vadds(cos_poly, ccoef1)
-    AscendC::Adds(cos_poly_5, cos_poly_4, CCOEF_1, processDataNum);
-    /// cos_poly = tbe.vmul(x_pow, cos_poly)
-    AscendC::Mul(cos_poly_6, x_pow, cos_poly_5, processDataNum);
-    /// cos_poly = tbe.vadds(cos_poly, tvm.const(1.0, dtype=dtype))
-    AscendC::Adds(cos_poly_7, cos_poly_6, 1.0f , processDataNum);
-
-    /// n2 = tbe.vadds(n2, tvm.const(1.0, dtype=dtype))
-    AscendC::Adds(n2_1, n2, 1.0f, processDataNum);
-    /// half_n2 = tbe.vmuls(n2, tvm.const(0.5, dtype=dtype))
-    AscendC::Muls(half_n2, n2_1, 0.5f, processDataNum);
-    /// half4_n2 = tbe.vmuls(n2, tvm.const(0.25, dtype=dtype))
-    AscendC::Muls(half4_n2, n2_1, 0.25f, processDataNum);
-    /// n_half2 = tbe.floor(half_n2, "float32")
-    AscendC::Cast(n_half2, half_n2, AscendC::RoundMode::CAST_FLOOR, processDataNum);
-    /// n_half4 = tbe.floor(half4_n2, "float32")
-    AscendC::Cast(n_half4, half4_n2, AscendC::RoundMode::CAST_FLOOR, processDataNum);
-    /// k1 = tbe.vmuls(n_half2, tvm.const(-2.0, dtype=dtype))
-    AscendC::Muls(k1, n_half2, -2.0f, processDataNum);
-    /// k2 = tbe.vmuls(n_half4, tvm.const(4.0, dtype=dtype))
-    AscendC::Muls(k2, n_half4, 4.0f, processDataNum);
-    /// sign = tbe.vadd(k1, k2)
-    AscendC::Add(sign, k1, k2, processDataNum);
-    /// sign = tbe.vadds(sign, tvm.const(1.0, dtype=dtype))
-    AscendC::Adds(sign_1, sign, 1.0f, processDataNum);
-
-    /// ifcos = tbe.vadd(n2, k1)
-    AscendC::Add(ifcos, n2_1, k1, processDataNum);
-    /// ifsin = tbe.vmuls(ifcos, tvm.const(-1.0, dtype=dtype))
-    AscendC::Muls(ifsin, ifcos, -1.0f, processDataNum);
-    /// ifsin = tbe.vadds(ifsin, tvm.const(1.0, dtype=dtype))
-    AscendC::Adds(ifsin_1, ifsin, 1.0f, processDataNum);
-
-    /// temp1 = tbe.vmul(sin_poly, ifsin)
-    AscendC::Mul(temp1, sin_poly_8, ifsin_1, processDataNum);
-    /// cos_poly = tbe.vmul(cos_poly, ifcos)
-    AscendC::Mul(cos_poly_8, cos_poly_7, ifcos, processDataNum);
-    /// res = tbe.vadd(temp1, cos_poly)
-    AscendC::Add(res, temp1, cos_poly_8, processDataNum);
-    /// res = tbe.vmul(res, sign)
-    AscendC::Mul(res_1, res, sign_1, processDataNum);
+template <class FallbackStrategy, int32_t BUFFER_NUM>
+__aicore__ inline void KernelCosHalf<FallbackStrategy, BUFFER_NUM>::Init(
+    GM_ADDR x, GM_ADDR y, uint64_t bigCoreDataNum, uint64_t smallCoreDataNum, uint64_t tailCoreDataNum,
+    uint32_t tileDataNum, uint32_t bigCoreNum, AscendC::TPipe* pipe)
+{
+    ASSERT(AscendC::GetBlockNum() != 0 && "block dim can not be zero!");
+    uint64_t globalBufferIndex = bigCoreDataNum * AscendC::GetBlockIdx();
+    if (AscendC::GetBlockIdx() < bigCoreNum) {
+        this->coreDataNum = bigCoreDataNum;
+    } else {
+        this->coreDataNum = smallCoreDataNum;
+        globalBufferIndex -= (bigCoreDataNum - smallCoreDataNum) * (AscendC::GetBlockIdx() - bigCoreNum);
+    }
+    if (AscendC::GetBlockIdx() == AscendC::GetBlockNum() - 1) {
+        this->coreDataNum = tailCoreDataNum;
+    }
+    this->tileDataNum = tileDataNum;
+
+    xGm.SetGlobalBuffer((__gm__ half*)x + globalBufferIndex, this->coreDataNum);
+    yGm.SetGlobalBuffer((__gm__ half*)y + globalBufferIndex, this->coreDataNum);
+    pipe->InitBuffer(inQueueX, BUFFER_NUM, this->tileDataNum * sizeof(half));
+    pipe->InitBuffer(outQueueY, BUFFER_NUM, this->tileDataNum * sizeof(half));
+    pipe->InitBuffer(xBuf, this->tileDataNum * sizeof(float));
+    pipe->InitBuffer(yBuf, this->tileDataNum * sizeof(float));
+    halfStrategy.InitBufImpl(pipe, this->tileDataNum);
+    strategy.InitBufImpl(pipe, this->tileDataNum);
 }
 
-extern "C" __global__ __aicore__ void cos(GM_ADDR x, GM_ADDR y, GM_ADDR workspace, GM_ADDR tiling)
+template <class FallbackStrategy, int32_t BUFFER_NUM>
+__aicore__ inline void KernelCosHalf<FallbackStrategy, BUFFER_NUM>::Process()
 {
-    GET_TILING_DATA(tiling_data, tiling);
+    uint64_t coreDataNum = this->coreDataNum;
+    uint64_t tileDataNum = this->tileDataNum;
+    for (uint64_t i = 0; i < coreDataNum; i += tileDataNum) {
+        uint32_t processDataNum = min(tileDataNum, coreDataNum - i);
+        CopyIn(i, processDataNum);
+        Compute(processDataNum);
+        CopyOut(i, processDataNum);
+    }
+}
 
-#if __CCE_AICORE__ == 200
-    using ComputeStrategy = RefStrategy;
-#elif defined(HIGH_PERFORMANCE) && HIGH_PERFORMANCE == 1
-    using ComputeStrategy = HighPerfStrategy;
-#else
-    using ComputeStrategy = HighPrecStrategy;
-#endif
+template <class FallbackStrategy, int32_t BUFFER_NUM>
+__aicore__ inline void KernelCosHalf<FallbackStrategy, BUFFER_NUM>::CopyIn(uint64_t offset, uint32_t processDataNum)
+{
+    AscendC::LocalTensor<half> xLocal = inQueueX.AllocTensor<half>();
+    if (processDataNum % BLOCK_ELEM_NUM == 0) {
+        AscendC::DataCopy(xLocal, xGm[offset], processDataNum);
+    } else {
+        AscendC::DataCopyExtParams copyParams{1, static_cast<uint32_t>(processDataNum * sizeof(half)), 0, 0, 0};
+        AscendC::DataCopyPadExtParams<half> padParams{false, 0, 0, 0};
+        AscendC::DataCopyPad(xLocal, xGm[offset], copyParams, padParams);
+    }
+    inQueueX.EnQue(xLocal);
+}
+
+template <class FallbackStrategy, int32_t BUFFER_NUM>
+__aicore__ inline bool KernelCosHalf<FallbackStrategy, BUFFER_NUM>::WithinHalfRange(
+    AscendC::LocalTensor<half>& xLocal, uint32_t processDataNum)
+{
+    // |x| into xBuf, the max and the reduction scratch into the two halves of yBuf
+    AscendC::LocalTensor<half> absLocal = xBuf.Get<half>();
+    AscendC::LocalTensor<half> maxLocal = yBuf.Get<half>();
+    AscendC::LocalTensor<half> workLocal = maxLocal[this->tileDataNum];
+    AscendC::Abs(absLocal, xLocal, processDataNum);
+    AscendC::ReduceMax(maxLocal, absLocal, workLocal, processDataNum);
+    event_t eventIdVToS = static_cast<event_t>(GetTPipePtr()->FetchEventID(AscendC::HardEvent::V_S));
+    AscendC::SetFlag<AscendC::HardEvent::V_S>(eventIdVToS);
+    AscendC::WaitFlag<AscendC::HardEvent::V_S>(eventIdVToS);
+    // NaN fails the comparison and takes the fp32 path like infinities
+    return static_cast<float>(maxLocal.GetValue(0)) <= HALF_MAX_ABS;
+}
+
+template <class FallbackStrategy, int32_t BUFFER_NUM>
+__aicore__ inline void KernelCosHalf<FallbackStrategy, BUFFER_NUM>::Compute(uint32_t processDataNum)
+{
+    AscendC::LocalTensor<half> xOrigin = inQueueX.DeQue<half>();
+    AscendC::LocalTensor<half> yTarget = outQueueY.AllocTensor<half>();
+    if (WithinHalfRange(xOrigin, processDataNum)) {
+        halfStrategy.ComputeImpl(xOrigin, yTarget, processDataNum);
+    } else {
+        AscendC::LocalTensor<float> xLocal = xBuf.Get<float>();
+        AscendC::LocalTensor<float> yLocal = yBuf.Get<float>();
+        AscendC::Cast(xLocal, xOrigin, AscendC::RoundMode::CAST_NONE, processDataNum);
+        strategy.ComputeImpl(xLocal, yLocal, processDataNum);
+        AscendC::Cast(yTarget, yLocal, AscendC::RoundMode::CAST_RINT, processDataNum);
+    }
+    inQueueX.FreeTensor(xOrigin);
+    outQueueY.EnQue(yTarget);
+}
 
-    KernelCos<DTYPE_X, ComputeStrategy> op;
+template <class FallbackStrategy, int32_t BUFFER_NUM>
+__aicore__ inline void KernelCosHalf<FallbackStrategy, BUFFER_NUM>::CopyOut(uint64_t offset, uint32_t processDataNum)
+{
+    AscendC::LocalTensor<half> yLocal = outQueueY.DeQue<half>();
+    if (processDataNum % BLOCK_ELEM_NUM == 0) {
+        AscendC::DataCopy(yGm[offset], yLocal, processDataNum);
+    } else {
+        AscendC::DataCopyExtParams copyParams{1, static_cast<uint32_t>(processDataNum * sizeof(half)), 0, 0, 0};
+        AscendC::DataCopyPad(yGm[offset], yLocal, copyParams);
+    }
+    outQueueY.FreeTensor(yLocal);
+}
+
+template <class FallbackStrategy>
+__aicore__ inline void RunKernelCosHalf(GM_ADDR x, GM_ADDR y, const CosTilingData& tiling_data)
+{
+    KernelCosHalf<FallbackStrategy> op;
     AscendC::TPipe pipe;
     op.Init(x, y,
             tiling_data.bigCoreDataNum,
             tiling_data.smallCoreDataNum,
+            tiling_data.tailCoreDataNum,
             tiling_data.tileDataNum,
             tiling_data.bigCoreNum,
             &pipe);
     op.Process();
 }
+
+// cos of every 16-bit pattern, COS_LUT_TABLE_NUM in op_host/cos_tiling_common.h
+constexpr uint32_t LUT_TABLE_NUM = 65536;
+// entry i holds the pattern of int16 i - LUT_TABLE_BIAS, so the signed widening of x is the index
+constexpr int32_t LUT_TABLE_BIAS = 32768;
+
+// 16-bit inputs only: y[i] = table[int16(x[i]) + 32768], where the table holds the ComputeStrategy result
+// of every pattern, so the output matches the tiling key of that strategy exactly. The table is built per
+// launch in the workspace, each core computing its slice, and loaded into UB whole
+template <class T, class ComputeStrategy, int32_t BUFFER_NUM = DEFAULT_BUFFER_NUM>
+class KernelCosLut
+{
+public:
+    __aicore__ inline KernelCosLut() {}
+    __aicore__ inline void Init(GM_ADDR x, GM_ADDR y, GM_ADDR workspace,
+                                uint64_t bigCoreDataNum,
+                                uint64_t smallCoreDataNum,
+                                uint64_t tailCoreDataNum,
+                                uint32_t tileDataNum,
+                                uint32_t bigCoreNum,
+                                AscendC::TPipe* pipe);
+    __aicore__ inline void Process();
+
+private:
+    template <class U>
+    static __aicore__ inline const U& min(const U& a, const U& b) { return (b < a) ? b : a; }
+
+    __aicore__ inline void BuildTable();
+    __aicore__ inline void CopyIn(uint64_t offset, uint32_t processDataNum);
+    __aicore__ inline void Compute(AscendC::LocalTensor<uint16_t>& tableLocal, uint32_t processDataNum);
+    __aicore__ inline void CopyOut(uint64_t offset, uint32_t processDataNum);
+
+private:
+    AscendC::TQue<AscendC::QuePosition::VECIN, 1> inQueueX, inQueueTable;
+    AscendC::TQue<AscendC::QuePosition::VECOUT, 1> outQueueY;
+    AscendC::TBuf<AscendC::QuePosition::VECCALC> xBuf, yBuf;
+    AscendC::GlobalTensor<T> xGm;
+    AscendC::GlobalTensor<T> yGm;
+    AscendC::GlobalTensor<T> tableGm;
+
+    uint64_t coreDataNum;
+    uint32_t tileDataNum;
+
+    ComputeStrategy strategy;
+
+    static constexpr uint32_t BLOCK_ELEM_NUM = 32 / sizeof(T);
+};
+
+template <class T, class ComputeStrategy, int32_t BUFFER_NUM>
+__aicore__ inline void KernelCosLut<T, ComputeStrategy, BUFFER_NUM>::Init(
+    GM_ADDR x, GM_ADDR y, GM_ADDR workspace, uint64_t bigCoreDataNum, uint64_t smallCoreDataNum,
+    uint64_t tailCoreDataNum, uint32_t tileDataNum, uint32_t bigCoreNum, AscendC::TPipe* pipe)
+{
+    ASSERT(AscendC::GetBlockNum() != 0 && "block dim can not be zero!");
+    uint64_t globalBufferIndex = bigCoreDataNum * AscendC::GetBlockIdx();
+    if (AscendC::GetBlockIdx() < bigCoreNum) {
+        this->coreDataNum = bigCoreDataNum;
+    } else {
+        this->coreDataNum = smallCoreDataNum;
+        globalBufferIndex -= (bigCoreDataNum - smallCoreDataNum) * (AscendC::GetBlockIdx() - bigCoreNum);
+    }
+    if (AscendC::GetBlockIdx() == AscendC::GetBlockNum() - 1) {
+        this->coreDataNum = tailCoreDataNum;
+    }
+    this->tileDataNum = tileDataNum;
+
+    xGm.SetGlobalBuffer((__gm__ T*)x + globalBufferIndex, this->coreDataNum);
+    yGm.SetGlobalBuffer((__gm__ T*)y + globalBufferIndex, this->coreDataNum);
+    tableGm.SetGlobalBuffer((__gm__ T*)AscendC::GetUserWorkspace(workspace), LUT_TABLE_NUM);
+    pipe->InitBuffer(inQueueX, BUFFER_NUM, this->tileDataNum * sizeof(T));
+    pipe->InitBuffer(outQueueY, BUFFER_NUM, this->tileDataNum * sizeof(T));
+    pipe->InitBuffer(inQueueTable, 1, LUT_TABLE_NUM * sizeof(T));
+    // float working copies while building the table, Gather offsets afterwards
+    pipe->InitBuffer(xBuf, this->tileDataNum * sizeof(float));
+    pipe->InitBuffer(yBuf, this->tileDataNum * sizeof(float));
+    strategy.InitBufImpl(pipe, this->tileDataNum);
+}
+
+template <class T, class ComputeStrategy, int32_t BUFFER_NUM>
+__aicore__ inline void KernelCosLut<T, ComputeStrategy, BUFFER_NUM>::BuildTable()
+{
+    // block-aligned slices, the last cores may get a shorter one or none
+    uint32_t sliceNum = (LUT_TABLE_NUM + AscendC::GetBlockNum() - 1) / AscendC::GetBlockNum();
+    sliceNum = (sliceNum + BLOCK_ELEM_NUM - 1) / BLOCK_ELEM_NUM * BLOCK_ELEM_NUM;
+    uint32_t sliceBegin = min<uint32_t>(sliceNum * AscendC::GetBlockIdx(), LUT_TABLE_NUM);
+    uint32_t sliceEnd = min<uint32_t>(sliceBegin + sliceNum, LUT_TABLE_NUM);
+    for (uint32_t i = sliceBegin; i < sliceEnd; i += this->tileDataNum) {
+        uint32_t processDataNum = min<uint32_t>(this->tileDataNum, sliceEnd - i);
+        AscendC::LocalTensor<T> yTarget = outQueueY.AllocTensor<T>();
+        AscendC::LocalTensor<float> xLocal = xBuf.Get<float>();
+        AscendC::LocalTensor<float> yLocal = yBuf.Get<float>();
+        // the table index less LUT_TABLE_BIAS is the bit pattern of the input it holds cos of
+        AscendC::CreateVecIndex(yTarget.template ReinterpretCast<int16_t>(),
+                                static_cast<int16_t>(static_cast<int32_t>(i) - LUT_TABLE_BIAS), processDataNum);
+        AscendC::Cast(xLocal, yTarget, AscendC::RoundMode::CAST_NONE, processDataNum);
+        strategy.ComputeImpl(xLocal, yLocal, processDataNum);
+        AscendC::Cast(yTarget, yLocal, AscendC::RoundMode::CAST_RINT, processDataNum);
+        outQueueY.EnQue(yTarget);
+        yTarget = outQueueY.DeQue<T>();
+        AscendC::DataCopy(tableGm[i], yTarget, processDataNum);
+        outQueueY.FreeTensor(yTarget);
+    }
+    AscendC::PipeBarrier<PIPE_ALL>();
+    AscendC::SyncAll();
+}
+
+template <class T, class ComputeStrategy, int32_t BUFFER_NUM>
+__aicore__ inline void KernelCosLut<T, ComputeStrategy, BUFFER_NUM>::Process()
+{
+    BuildTable();
+    AscendC::LocalTensor<T> tableOrigin = inQueueTable.AllocTensor<T>();
+    AscendC::DataCopy(tableOrigin, tableGm, LUT_TABLE_NUM);
+    inQueueTable.EnQue(tableOrigin);
+    AscendC::LocalTensor<uint16_t> tableLocal = inQueueTable.DeQue<T>().template ReinterpretCast<uint16_t>();
+
+    uint64_t coreDataNum = this->coreDataNum;
+    uint64_t tileDataNum = this->tileDataNum;
+    for (uint64_t i = 0; i < coreDataNum; i += tileDataNum) {
+        uint32_t processDataNum = min(tileDataNum, coreDataNum - i);
+        CopyIn(i, processDataNum);
+        Compute(tableLocal, processDataNum);
+        CopyOut(i, processDataNum);
+    }
+    inQueueTable.FreeTensor(tableLocal);
+}
+
+template <class T, class ComputeStrategy, int32_t BUFFER_NUM>
+__aicore__ inline void KernelCosLut<T, ComputeStrategy, BUFFER_NUM>::CopyIn(uint64_t offset, uint32_t processDataNum)
+{
+    AscendC::LocalTensor<T> xLocal = inQueueX.AllocTensor<T>();
+    if (processDataNum % BLOCK_ELEM_NUM == 0) {
+        AscendC::DataCopy(xLocal, xGm[offset], processDataNum);
+    } else {
+        AscendC::DataCopyExtParams copyParams{1, static_cast<uint32_t>(processDataNum * sizeof(T)), 0, 0, 0};
+        AscendC::DataCopyPadExtParams<T> padParams{false, 0, 0, 0};
+        AscendC::DataCopyPad(xLocal, xGm[offset], copyParams, padParams);
+    }
+    inQueueX.EnQue(xLocal);
+}
+
+template <class T, class ComputeStrategy, int32_t BUFFER_NUM>
+__aicore__ inline void KernelCosLut<T, ComputeStrategy, BUFFER_NUM>::Compute(AscendC::LocalTensor<uint16_t>& tableLocal,
+                                                            uint32_t processDataNum)
+{
+    AscendC::LocalTensor<uint16_t> bits = inQueueX.DeQue<T>().template ReinterpretCast<uint16_t>();
+    AscendC::LocalTensor<float> indexFloat = xBuf.Get<float>();
+    AscendC::LocalTensor<int32_t> offset = yBuf.Get<int32_t>();
+    // widen to the uint32 byte offsets Gather takes; the casts and the bias are exact below 2^16
+    AscendC::Cast(indexFloat, bits.ReinterpretCast<int16_t>(), AscendC::RoundMode::CAST_NONE, processDataNum);
+    inQueueX.FreeTensor(bits);
+    AscendC::Adds(indexFloat, indexFloat, static_cast<float>(LUT_TABLE_BIAS), processDataNum);
+    AscendC::Cast(offset, indexFloat, AscendC::RoundMode::CAST_RINT, processDataNum);
+    AscendC::ShiftLeft(offset, offset, static_cast<int32_t>(1), processDataNum);
+
+    AscendC::LocalTensor<T> yTarget = outQueueY.AllocTensor<T>();
+    AscendC::Gather(yTarget.template ReinterpretCast<uint16_t>(), tableLocal, offset.ReinterpretCast<uint32_t>(),
+                    static_cast<uint32_t>(0), processDataNum);
+    outQueueY.EnQue(yTarget);
+}
+
+template <class T, class ComputeStrategy, int32_t BUFFER_NUM>
+__aicore__ inline void KernelCosLut<T, ComputeStrategy, BUFFER_NUM>::CopyOut(uint64_t offset, uint32_t processDataNum)
+{
+    AscendC::LocalTensor<T> yLocal = outQueueY.DeQue<T>();
+    if (processDataNum % BLOCK_ELEM_NUM == 0) {
+        AscendC::DataCopy(yGm[offset], yLocal, processDataNum);
+    } else {
+        AscendC::DataCopyExtParams copyParams{1, static_cast<uint32_t>(processDataNum * sizeof(T)), 0, 0, 0};
+        AscendC::DataCopyPad(yGm[offset], yLocal, copyParams);
+    }
+    outQueueY.FreeTensor(yLocal);
+}
+
+// tiling keys 17 to 67 only come for 16-bit x with y of the same type
+template <class ComputeStrategy>
+__aicore__ inline void RunKernelCosLut(GM_ADDR x, GM_ADDR y, GM_ADDR workspace, const CosTilingData& tiling_data)
+{
+    if constexpr (!std::is_same_v<DTYPE_X, float> && std::is_same_v<DTYPE_X, DTYPE_Y>) {
+        KernelCosLut<DTYPE_X, ComputeStrategy> op;
+        AscendC::TPipe pipe;
+        op.Init(x, y, workspace,
+                tiling_data.bigCoreDataNum,
+                tiling_data.smallCoreDataNum,
+                tiling_data.tailCoreDataNum,
+                tiling_data.tileDataNum,
+                tiling_data.bigCoreNum,
+                &pipe);
+        op.Process();
+    }
+}
+
+extern "C" __global__ __aicore__ void cos(GM_ADDR x, GM_ADDR y, GM_ADDR workspace, GM_ADDR tiling)
+{
+    GET_TILING_DATA(tiling_data, tiling);
+
+#if __CCE_AICORE__ == 200
+    // 310P only carries the reference strategy
+    using PrecStrategy = RefStrategy;
+    using PerfStrategy = RefStrategy;
+    using PrecShortStrategy = RefStrategy;
+    using NoReduceStrategy = RefStrategy;
+    using PrecUnfusedStrategy = RefStrategy;
+    using PerfUnfusedStrategy = RefStrategy;
+#else
+    using PrecStrategy = HighPrecFusedStrategy;
+    using PerfStrategy = HighPerfFusedStrategy;
+    using PrecShortStrategy = HighPrecShortStrategy;
+    using NoReduceStrategy = HighPrecNoReduceStrategy;
+    using PrecUnfusedStrategy = HighPrecStrategy;
+    using PerfUnfusedStrategy = HighPerfStrategy;
+#endif
+
+    // tiling keys come from COS_TILING_KEY_* in op_host/cos_tiling_common.h: the last digit selects the
+    // strategy, the tens digit the static shape bucket in COS_STATIC_CORE_DATA_NUM (0 = generic split);
+    // strategies 3 to 8 only use the generic split, key 8 being the fp16 native one. Key 7 is the 16-bit
+    // table kernel, its tens digit the key whose strategy builds the table. The hundreds digit selects the
+    // queue depth of the generic keys 1 and 2 (0 = double buffering, 1 = single, 3 = triple). The thousands
+    // digit marks keys 1 to 6 reading a strided view of x
+    if (TILING_KEY_IS(1)) {
+        RunKernelCos<PrecStrategy>(x, y, tiling_data);
+    } else if (TILING_KEY_IS(2)) {
+        RunKernelCos<PerfStrategy>(x, y, tiling_data);
+    } else if (TILING_KEY_IS(3)) {
+        RunKernelCos<PrecShortStrategy>(x, y, tiling_data);
+    } else if (TILING_KEY_IS(4)) {
+        RunKernelCos<NoReduceStrategy>(x, y, tiling_data);
+    } else if (TILING_KEY_IS(5)) {
+        RunKernelCos<PrecUnfusedStrategy>(x, y, tiling_data);
+    } else if (TILING_KEY_IS(6)) {
+        RunKernelCos<PerfUnfusedStrategy>(x, y, tiling_data);
+#if __CCE_AICORE__ != 200
+    // the fp16 native kernel and the table kernels are not built for Atlas inference products
+    } else if (TILING_KEY_IS(8)) {
+        if constexpr (std::is_same_v<DTYPE_X, half> && std::is_same_v<DTYPE_Y, half>) {
+            RunKernelCosHalf<PerfStrategy>(x, y, tiling_data);
+        }
+    } else if (TILING_KEY_IS(17)) {
+        RunKernelCosLut<PrecStrategy>(x, y, workspace, tiling_data);
+    } else if (TILING_KEY_IS(27)) {
+        RunKernelCosLut<PerfStrategy>(x, y, workspace, tiling_data);
+    } else if (TILING_KEY_IS(37)) {
+        RunKernelCosLut<PrecShortStrategy>(x, y, workspace, tiling_data);
+    } else if (TILING_KEY_IS(47)) {
+        RunKernelCosLut<NoReduceStrategy>(x, y, workspace, tiling_data);
+    } else if (TILING_KEY_IS(57)) {
+        RunKernelCosLut<PrecUnfusedStrategy>(x, y, workspace, tiling_data);
+    } else if (TILING_KEY_IS(67)) {
+        RunKernelCosLut<PerfUnfusedStrategy>(x, y, workspace, tiling_data);
+#endif
+    } else if (TILING_KEY_IS(1001)) {
+        RunKernelCosView<PrecStrategy>(x, y, tiling_data);
+    } else if (TILING_KEY_IS(1002)) {
+        RunKernelCosView<PerfStrategy>(x, y, tiling_data);
+    } else if (TILING_KEY_IS(1003)) {
+        RunKernelCosView<PrecShortStrategy>(x, y, tiling_data);
+    } else if (TILING_KEY_IS(1004)) {
+        RunKernelCosView<NoReduceStrategy>(x, y, tiling_data);
+    } else if (TILING_KEY_IS(1005)) {
+        RunKernelCosView<PrecUnfusedStrategy>(x, y, tiling_data);
+    } else if (TILING_KEY_IS(1006)) {
+        RunKernelCosView<PerfUnfusedStrategy>(x, y, tiling_data);
+    } else if (TILING_KEY_IS(101)) {
+        RunKernelCos<PrecStrategy, 0, 1>(x, y, tiling_data);
+    } else if (TILING_KEY_IS(102)) {
+        RunKernelCos<PerfStrategy, 0, 1>(x, y, tiling_data);
+    } else if (TILING_KEY_IS(301)) {
+        RunKernelCos<PrecStrategy, 0, 3>(x, y, tiling_data);
+    } else if (TILING_KEY_IS(302)) {
+        RunKernelCos<PerfStrategy, 0, 3>(x, y, tiling_data);
+    } else if (TILING_KEY_IS(11)) {
+        RunKernelCos<PrecStrategy, 2048>(x, y, tiling_data);
+    } else if (TILING_KEY_IS(12)) {
+        RunKernelCos<PerfStrategy, 2048>(x, y, tiling_data);
+    } else if (TILING_KEY_IS(21)) {
+        RunKernelCos<PrecStrategy, 4096>(x, y, tiling_data);
+    } else if (TILING_KEY_IS(22)) {
+        RunKernelCos<PerfStrategy, 4096>(x, y, tiling_data);
+    } else if (TILING_KEY_IS(31)) {
+        RunKernelCos<PrecStrategy, 6144>(x, y, tiling_data);
+    } else if (TILING_KEY_IS(32)) {
+        RunKernelCos<PerfStrategy, 6144>(x, y, tiling_data);
+    } else if (TILING_KEY_IS(41)) {
+        RunKernelCos<PrecStrategy, 8192>(x, y, tiling_data);
+    } else if (TILING_KEY_IS(42)) {
+        RunKernelCos<PerfStrategy, 8192>(x, y, tiling_data);
+    } else if (TILING_KEY_IS(51)) {
+        RunKernelCos<PrecStrategy, 16384>(x, y, tiling_data);
+    } else if (TILING_KEY_IS(52)) {
+        RunKernelCos<PerfStrategy, 16384>(x, y, tiling_data);
+    } else if (TILING_KEY_IS(61)) {
+        RunKernelCos<PrecStrategy, 32768>(x, y, tiling_data);
+    } else if (TILING_KEY_IS(62)) {
+        RunKernelCos<PerfStrategy, 32768>(x, y, tiling_data);
+    } else if (TILING_KEY_IS(71)) {
+        RunKernelCos<PrecStrategy, 65536>(x, y, tiling_data);
+    } else if (TILING_KEY_IS(72)) {
+        RunKernelCos<PerfStrategy, 65536>(x, y, tiling_data);
+    }
+}
@@ -0,0 +1,252 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * @file cos_grad.cpp
+ */
+#include "kernel_operator.h"
+#include "cos_strategy.h"
+
+constexpr int32_t BUFFER_NUM = 2;
+
+// dx = -dy * sin(x). With SAVED_SIN the second input is the sin(x) saved by the forward pass, so the range
+// reduction and polynomials are skipped
+template <class T, class ComputeStrategy, bool SAVED_SIN>
+class KernelCosGrad
+{
+public:
+    __aicore__ inline KernelCosGrad() {}
+    __aicore__ inline void Init(GM_ADDR dy, GM_ADDR x, GM_ADDR dx,
+                                uint64_t bigCoreDataNum,
+                                uint64_t smallCoreDataNum,
+                                uint64_t tailCoreDataNum,
+                                uint32_t tileDataNum,
+                                uint32_t bigCoreNum,
+                                AscendC::TPipe* pipe);
+    __aicore__ inline void Process();
+
+private:
+    template <class U>
+    static __aicore__ inline const U& min(const U& a, const U& b) { return (b < a) ? b : a; }
+
+    __aicore__ inline void CopyIn(uint64_t offset, uint32_t processDataNum);
+    __aicore__ inline void Compute(uint32_t processDataNum);
+    __aicore__ inline void CopyOut(uint64_t offset, uint32_t processDataNum);
+
+    __aicore__ inline void CopyInQue(AscendC::TQue<AscendC::QuePosition::VECIN, 1>& inQueue,
+                                     AscendC::GlobalTensor<T>& inGm,
+                                     uint64_t offset, uint32_t processDataNum);
+    __aicore__ inline AscendC::LocalTensor<float> PreDeQueCast(AscendC::TQue<AscendC::QuePosition::VECIN, 1>& inQueue,
+                                                               AscendC::TBuf<AscendC::QuePosition::VECCALC>& inBuf,
+                                                               uint32_t processDataNum);
+    __aicore__ inline AscendC::LocalTensor<float> PreAllocateDx();
+    __aicore__ inline void PostCastEnQue(AscendC::LocalTensor<float>& dxLocal, uint32_t processDataNum);
+
+private:
+    AscendC::TQue<AscendC::QuePosition::VECIN, 1> inQueueDy, inQueueX;
+    AscendC::TQue<AscendC::QuePosition::VECOUT, 1> outQueueDx;
+    AscendC::TBuf<AscendC::QuePosition::VECCALC> dyBuf, xBuf, dxBuf, sinBuf;
+    AscendC::GlobalTensor<T> dyGm;
+    AscendC::GlobalTensor<T> xGm;
+    AscendC::GlobalTensor<T> dxGm;
+
+    uint64_t coreDataNum;
+    uint32_t tileDataNum;
+
+    ComputeStrategy strategy;
+
+    static constexpr uint32_t BLOCK_ELEM_NUM = 32 / sizeof(T);
+};
+
+template <class T, class ComputeStrategy, bool SAVED_SIN>
+__aicore__ inline void KernelCosGrad<T, ComputeStrategy, SAVED_SIN>::Init(GM_ADDR dy, GM_ADDR x, GM_ADDR dx,
+                                                                          uint64_t bigCoreDataNum,
+                                                                          uint64_t smallCoreDataNum,
+                                                                          uint64_t tailCoreDataNum,
+                                                                          uint32_t tileDataNum,
+                                                                          uint32_t bigCoreNum,
+                                                                          AscendC::TPipe* pipe)
+{
+    ASSERT(AscendC::GetBlockNum() != 0 && "block dim can not be zero!");
+    uint64_t globalBufferIndex = bigCoreDataNum * AscendC::GetBlockIdx();
+    if (AscendC::GetBlockIdx() < bigCoreNum) {
+        this->coreDataNum = bigCoreDataNum;
+    } else {
+        this->coreDataNum = smallCoreDataNum;
+        globalBufferIndex -= (bigCoreDataNum - smallCoreDataNum) * (AscendC::GetBlockIdx() - bigCoreNum);
+    }
+    // the last core ends exactly at the logical end of dy
+    if (AscendC::GetBlockIdx() == AscendC::GetBlockNum() - 1) {
+        this->coreDataNum = tailCoreDataNum;
+    }
+    this->tileDataNum = tileDataNum;
+
+    dyGm.SetGlobalBuffer((__gm__ T*)dy + globalBufferIndex, this->coreDataNum);
+    xGm.SetGlobalBuffer((__gm__ T*)x + globalBufferIndex, this->coreDataNum);
+    dxGm.SetGlobalBuffer((__gm__ T*)dx + globalBufferIndex, this->coreDataNum);
+    pipe->InitBuffer(inQueueDy, BUFFER_NUM, this->tileDataNum * sizeof(T));
+    pipe->InitBuffer(inQueueX, BUFFER_NUM, this->tileDataNum * sizeof(T));
+    pipe->InitBuffer(outQueueDx, BUFFER_NUM, this->tileDataNum * sizeof(T));
+    if constexpr (!std::is_same_v<T, float>) {
+        pipe->InitBuffer(dyBuf, this->tileDataNum * sizeof(float));
+        pipe->InitBuffer(xBuf, this->tileDataNum * sizeof(float));
+        pipe->InitBuffer(dxBuf, this->tileDataNum * sizeof(float));
+    }
+    if constexpr (!SAVED_SIN) {
+        pipe->InitBuffer(sinBuf, this->tileDataNum * sizeof(float));
+        strategy.InitBufImpl(pipe, this->tileDataNum);
+    }
+}
+
+template <class T, class ComputeStrategy, bool SAVED_SIN>
+__aicore__ inline void KernelCosGrad<T, ComputeStrategy, SAVED_SIN>::Process()
+{
+    uint64_t coreDataNum = this->coreDataNum;
+    uint64_t tileDataNum = this->tileDataNum;
+    for (uint64_t i = 0; i < coreDataNum; i += tileDataNum) {
+        uint32_t processDataNum = min(tileDataNum, coreDataNum - i);
+        CopyIn(i, processDataNum);
+        Compute(processDataNum);
+        CopyOut(i, processDataNum);
+    }
+}
+
+template <class T, class ComputeStrategy, bool SAVED_SIN>
+__aicore__ inline void KernelCosGrad<T, ComputeStrategy, SAVED_SIN>::CopyIn(uint64_t offset, uint32_t processDataNum)
+{
+    CopyInQue(inQueueDy, dyGm, offset, processDataNum);
+    CopyInQue(inQueueX, xGm, offset, processDataNum);
+}
+
+template <class T, class ComputeStrategy, bool SAVED_SIN>
+__aicore__ inline void KernelCosGrad<T, ComputeStrategy, SAVED_SIN>::Compute(uint32_t processDataNum)
+{
+    AscendC::LocalTensor<float> dyLocal = PreDeQueCast(inQueueDy, dyBuf, processDataNum);
+    // x, or sin(x) itself when it was saved
+    AscendC::LocalTensor<float> xLocal = PreDeQueCast(inQueueX, xBuf, processDataNum);
+    AscendC::LocalTensor<float> dxLocal = PreAllocateDx();
+
+    if constexpr (SAVED_SIN) {
+        AscendC::Mul(dxLocal, dyLocal, xLocal, processDataNum);
+    } else {
+        // dxLocal carries the polynomials until sin(x) is selected into sinLocal
+        AscendC::LocalTensor<float> sinLocal = sinBuf.Get<float>();
+        strategy.ComputeSinImpl(xLocal, dxLocal, sinLocal, processDataNum);
+        AscendC::Mul(dxLocal, dyLocal, sinLocal, processDataNum);
+    }
+    AscendC::Muls(dxLocal, dxLocal, -1.0f, processDataNum);
+
+    if constexpr (std::is_same_v<T, float>) {
+        inQueueDy.FreeTensor(dyLocal);
+        inQueueX.FreeTensor(xLocal);
+    }
+    PostCastEnQue(dxLocal, processDataNum);
+}
+
+template <class T, class ComputeStrategy, bool SAVED_SIN>
+__aicore__ inline void KernelCosGrad<T, ComputeStrategy, SAVED_SIN>::CopyOut(uint64_t offset, uint32_t processDataNum)
+{
+    AscendC::LocalTensor<T> dxLocal = outQueueDx.DeQue<T>();
+    if (processDataNum % BLOCK_ELEM_NUM == 0) {
+        AscendC::DataCopy(dxGm[offset], dxLocal, processDataNum);
+    } else {
+        AscendC::DataCopyExtParams copyParams{1, static_cast<uint32_t>(processDataNum * sizeof(T)), 0, 0, 0};
+        AscendC::DataCopyPad(dxGm[offset], dxLocal, copyParams);
+    }
+    outQueueDx.FreeTensor(dxLocal);
+}
+
+template <class T, class ComputeStrategy, bool SAVED_SIN>
+__aicore__ inline void KernelCosGrad<T, ComputeStrategy, SAVED_SIN>::CopyInQue(
+    AscendC::TQue<AscendC::QuePosition::VECIN, 1>& inQueue,
+    AscendC::GlobalTensor<T>& inGm,
+    uint64_t offset, uint32_t processDataNum)
+{
+    AscendC::LocalTensor<T> inLocal = inQueue.AllocTensor<T>();
+    if (processDataNum % BLOCK_ELEM_NUM == 0) {
+        AscendC::DataCopy(inLocal, inGm[offset], processDataNum);
+    } else {
+        AscendC::DataCopyExtParams copyParams{1, static_cast<uint32_t>(processDataNum * sizeof(T)), 0, 0, 0};
+        AscendC::DataCopyPadExtParams<T> padParams{false, 0, 0, 0};
+        AscendC::DataCopyPad(inLocal, inGm[offset], copyParams, padParams);
+    }
+    inQueue.EnQue(inLocal);
+}
+
+template <class T, class ComputeStrategy, bool SAVED_SIN>
+__aicore__ inline AscendC::LocalTensor<float> KernelCosGrad<T, ComputeStrategy, SAVED_SIN>::PreDeQueCast(
+    AscendC::TQue<AscendC::QuePosition::VECIN, 1>& inQueue,
+    AscendC::TBuf<AscendC::QuePosition::VECCALC>& inBuf,
+    uint32_t processDataNum)
+{
+    if constexpr (std::is_same_v<T, float>) {
+        AscendC::LocalTensor<float> inLocal = inQueue.DeQue<float>();
+        return inLocal;
+    } else {
+        AscendC::LocalTensor<float> inLocal = inBuf.Get<float>();
+        AscendC::LocalTensor<T> inOrigin = inQueue.DeQue<T>();
+        AscendC::Cast(inLocal, inOrigin, AscendC::RoundMode::CAST_NONE, processDataNum);
+        inQueue.FreeTensor(inOrigin);
+        return inLocal;
+    }
+}
+
+template <class T, class ComputeStrategy, bool SAVED_SIN>
+__aicore__ inline AscendC::LocalTensor<float> KernelCosGrad<T, ComputeStrategy, SAVED_SIN>::PreAllocateDx()
+{
+    if constexpr (std::is_same_v<T, float>) {
+        AscendC::LocalTensor<float> dxLocal = outQueueDx.AllocTensor<float>();
+        return dxLocal;
+    } else {
+        AscendC::LocalTensor<float> dxLocal = dxBuf.Get<float>();
+        return dxLocal;
+    }
+}
+
+template <class T, class ComputeStrategy, bool SAVED_SIN>
+__aicore__ inline void KernelCosGrad<T, ComputeStrategy, SAVED_SIN>::PostCastEnQue(AscendC::LocalTensor<float>& dxLocal,
+                                                                                   uint32_t processDataNum)
+{
+    if constexpr (std::is_same_v<T, float>) {
+        outQueueDx.EnQue(dxLocal);
+    } else {
+        AscendC::LocalTensor<T> dxTarget = outQueueDx.AllocTensor<T>();
+        AscendC::Cast(dxTarget, dxLocal, AscendC::RoundMode::CAST_RINT, processDataNum);
+        outQueueDx.EnQue(dxTarget);
+    }
+}
+
+template <bool SAVED_SIN>
+__aicore__ inline void RunKernelCosGrad(GM_ADDR dy, GM_ADDR x, GM_ADDR dx, const CosTilingData& tiling_data)
+{
+    KernelCosGrad<DTYPE_DY, HighPrecFusedStrategy, SAVED_SIN> op;
+    AscendC::TPipe pipe;
+    op.Init(dy, x, dx,
+            tiling_data.bigCoreDataNum,
+            tiling_data.smallCoreDataNum,
+            tiling_data.tailCoreDataNum,
+            tiling_data.tileDataNum,
+            tiling_data.bigCoreNum,
+            &pipe);
+    op.Process();
+}
+
+extern "C" __global__ __aicore__ void cos_grad(GM_ADDR dy, GM_ADDR x, GM_ADDR sin_x, GM_ADDR dx,
+                                               GM_ADDR workspace, GM_ADDR tiling)
+{
+    GET_TILING_DATA(tiling_data, tiling);
+
+    // tiling keys COS_GRAD_TILING_KEY_* in op_host/cos_tiling_common.h
+    if (TILING_KEY_IS(1)) {
+        RunKernelCosGrad<false>(dy, x, dx, tiling_data);
+    } else if (TILING_KEY_IS(2)) {
+        RunKernelCosGrad<true>(dy, sin_x, dx, tiling_data);
+    }
+}
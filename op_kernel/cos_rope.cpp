@@ -0,0 +1,343 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * @file cos_rope.cpp
+ */
+#include "kernel_operator.h"
+#include "cos_strategy.h"
+
+constexpr int32_t BUFFER_NUM = 2;
+
+// y = x * cos(pos * inv_freq) + rotate_half(x) * sin(pos * inv_freq), rotate_half(x) = [-x2, x1] for the halves
+// x1 and x2 of each row. The angles of a token are built in UB and range-reduced once for all of its heads.
+template <class T, class P, class ComputeStrategy>
+class KernelCosRope
+{
+public:
+    __aicore__ inline KernelCosRope() {}
+    __aicore__ inline void Init(GM_ADDR x, GM_ADDR positions, GM_ADDR invFreq, GM_ADDR y,
+                                uint64_t bigCoreDataNum,
+                                uint64_t smallCoreDataNum,
+                                uint64_t tailCoreDataNum,
+                                uint32_t tileDataNum,
+                                uint32_t bigCoreNum,
+                                uint32_t headNum,
+                                uint32_t headDim,
+                                uint32_t tokenTileNum,
+                                AscendC::TPipe* pipe);
+    __aicore__ inline void Process();
+
+private:
+    template <class U>
+    static __aicore__ inline const U& min(const U& a, const U& b) { return (b < a) ? b : a; }
+    template <class U>
+    static __aicore__ inline const U& max(const U& a, const U& b) { return (b < a) ? a : b; }
+
+    __aicore__ inline void CopyIn(uint64_t rowStart, uint32_t rowNum);
+    __aicore__ inline void Compute(uint64_t rowStart, uint32_t rowNum);
+    __aicore__ inline void CopyOut(uint64_t rowStart, uint32_t rowNum);
+
+    // rotates rowNum rows of one token starting at row rowOffset of the tile, cos/sin/-sin of that token
+    __aicore__ inline void RotateRows(const AscendC::LocalTensor<float>& xLocal,
+                                      const AscendC::LocalTensor<float>& yLocal,
+                                      const AscendC::LocalTensor<float>& cosLocal,
+                                      const AscendC::LocalTensor<float>& sinLocal,
+                                      const AscendC::LocalTensor<float>& negSinLocal,
+                                      uint32_t rowOffset, uint32_t rowNum);
+
+    __aicore__ inline AscendC::LocalTensor<float> PreDeQueCastPos(uint32_t tokenNum);
+    __aicore__ inline AscendC::LocalTensor<float> PreDeQueCastX(uint32_t processDataNum);
+    __aicore__ inline AscendC::LocalTensor<float> PreAllocateY();
+    __aicore__ inline void PostCastEnQue(AscendC::LocalTensor<float>& yLocal, uint32_t processDataNum);
+
+private:
+    AscendC::TQue<AscendC::QuePosition::VECIN, 1> inQueueX, inQueuePos, inQueueFreq;
+    AscendC::TQue<AscendC::QuePosition::VECOUT, 1> outQueueY;
+    AscendC::TBuf<AscendC::QuePosition::VECCALC> xBuf, yBuf, posBuf, posBrcbBuf, angleBuf, sinBuf, cosBuf;
+    AscendC::GlobalTensor<T> xGm;
+    AscendC::GlobalTensor<P> posGm;
+    AscendC::GlobalTensor<float> freqGm;
+    AscendC::GlobalTensor<T> yGm;
+    AscendC::LocalTensor<float> freqLocal;
+
+    uint64_t coreRowStart;
+    uint64_t coreDataNum;
+    uint32_t tileDataNum;
+    uint32_t headNum;
+    uint32_t headDim;
+    uint32_t halfDim;
+
+    ComputeStrategy strategy;
+
+    static constexpr uint32_t MAX_REPEAT_TIMES = 255;
+    static constexpr uint32_t REPEAT_ELEM_NUM = 256 / sizeof(float);
+    // Brcb takes this many positions per repeat and writes each of them into its own 32-byte block
+    static constexpr uint32_t BLOCK_ELEM_NUM = 32 / sizeof(float);
+};
+
+template <class T, class P, class ComputeStrategy>
+__aicore__ inline void KernelCosRope<T, P, ComputeStrategy>::Init(GM_ADDR x, GM_ADDR positions, GM_ADDR invFreq,
+                                                                  GM_ADDR y,
+                                                                  uint64_t bigCoreDataNum,
+                                                                  uint64_t smallCoreDataNum,
+                                                                  uint64_t tailCoreDataNum,
+                                                                  uint32_t tileDataNum,
+                                                                  uint32_t bigCoreNum,
+                                                                  uint32_t headNum,
+                                                                  uint32_t headDim,
+                                                                  uint32_t tokenTileNum,
+                                                                  AscendC::TPipe* pipe)
+{
+    ASSERT(AscendC::GetBlockNum() != 0 && "block dim can not be zero!");
+    uint64_t globalBufferIndex = bigCoreDataNum * AscendC::GetBlockIdx();
+    if (AscendC::GetBlockIdx() < bigCoreNum) {
+        this->coreDataNum = bigCoreDataNum;
+    } else {
+        this->coreDataNum = smallCoreDataNum;
+        globalBufferIndex -= (bigCoreDataNum - smallCoreDataNum) * (AscendC::GetBlockIdx() - bigCoreNum);
+    }
+    // the last core ends exactly at the last row of x
+    if (AscendC::GetBlockIdx() == AscendC::GetBlockNum() - 1) {
+        this->coreDataNum = tailCoreDataNum;
+    }
+    this->coreRowStart = globalBufferIndex;
+    this->tileDataNum = tileDataNum;
+    this->headNum = headNum;
+    this->headDim = headDim;
+    this->halfDim = headDim / 2;
+
+    // rows are whole 32-byte blocks (headDim % 16 == 0), the positions are indexed by token from the tile
+    xGm.SetGlobalBuffer((__gm__ T*)x + globalBufferIndex * headDim, this->coreDataNum * headDim);
+    yGm.SetGlobalBuffer((__gm__ T*)y + globalBufferIndex * headDim, this->coreDataNum * headDim);
+    posGm.SetGlobalBuffer((__gm__ P*)positions);
+    freqGm.SetGlobalBuffer((__gm__ float*)invFreq, this->halfDim);
+
+    uint32_t tileRowDataNum = this->tileDataNum * headDim;
+    uint32_t tileAngleNum = tokenTileNum * this->halfDim;
+    pipe->InitBuffer(inQueueX, BUFFER_NUM, tileRowDataNum * sizeof(T));
+    pipe->InitBuffer(outQueueY, BUFFER_NUM, tileRowDataNum * sizeof(T));
+    pipe->InitBuffer(inQueuePos, BUFFER_NUM, AscendC::AlignUp(tokenTileNum * sizeof(P), 32));
+    pipe->InitBuffer(inQueueFreq, 1, this->halfDim * sizeof(float));
+    if constexpr (!std::is_same_v<T, float>) {
+        pipe->InitBuffer(xBuf, tileRowDataNum * sizeof(float));
+        pipe->InitBuffer(yBuf, tileRowDataNum * sizeof(float));
+    }
+    if constexpr (!std::is_same_v<P, float>) {
+        pipe->InitBuffer(posBuf, AscendC::AlignUp(tokenTileNum * sizeof(float), 32));
+    }
+    pipe->InitBuffer(posBrcbBuf, AscendC::AlignUp(tokenTileNum, BLOCK_ELEM_NUM) * 32);
+    pipe->InitBuffer(angleBuf, tileAngleNum * sizeof(float));
+    pipe->InitBuffer(sinBuf, tileAngleNum * sizeof(float));
+    pipe->InitBuffer(cosBuf, tileAngleNum * sizeof(float));
+    strategy.InitBufImpl(pipe, tileAngleNum);
+
+    // inv_freq stays in UB for the whole kernel
+    AscendC::LocalTensor<float> freqIn = inQueueFreq.AllocTensor<float>();
+    AscendC::DataCopy(freqIn, freqGm, this->halfDim);
+    inQueueFreq.EnQue(freqIn);
+    freqLocal = inQueueFreq.DeQue<float>();
+}
+
+template <class T, class P, class ComputeStrategy>
+__aicore__ inline void KernelCosRope<T, P, ComputeStrategy>::Process()
+{
+    uint64_t coreDataNum = this->coreDataNum;
+    uint64_t tileDataNum = this->tileDataNum;
+    for (uint64_t i = 0; i < coreDataNum; i += tileDataNum) {
+        uint32_t processRowNum = min(tileDataNum, coreDataNum - i);
+        CopyIn(i, processRowNum);
+        Compute(i, processRowNum);
+        CopyOut(i, processRowNum);
+    }
+    inQueueFreq.FreeTensor(freqLocal);
+}
+
+template <class T, class P, class ComputeStrategy>
+__aicore__ inline void KernelCosRope<T, P, ComputeStrategy>::CopyIn(uint64_t rowStart, uint32_t rowNum)
+{
+    AscendC::LocalTensor<T> xLocal = inQueueX.AllocTensor<T>();
+    AscendC::DataCopy(xLocal, xGm[rowStart * headDim], rowNum * headDim);
+    inQueueX.EnQue(xLocal);
+
+    uint64_t tokenStart = (coreRowStart + rowStart) / headNum;
+    uint32_t tokenNum = static_cast<uint32_t>((coreRowStart + rowStart + rowNum - 1) / headNum - tokenStart + 1);
+    AscendC::LocalTensor<P> posLocal = inQueuePos.AllocTensor<P>();
+    AscendC::DataCopyExtParams copyParams{1, static_cast<uint32_t>(tokenNum * sizeof(P)), 0, 0, 0};
+    AscendC::DataCopyPadExtParams<P> padParams{false, 0, 0, 0};
+    AscendC::DataCopyPad(posLocal, posGm[tokenStart], copyParams, padParams);
+    inQueuePos.EnQue(posLocal);
+}
+
+template <class T, class P, class ComputeStrategy>
+__aicore__ inline void KernelCosRope<T, P, ComputeStrategy>::Compute(uint64_t rowStart, uint32_t rowNum)
+{
+    uint64_t tileRowStart = coreRowStart + rowStart;
+    uint64_t tokenStart = tileRowStart / headNum;
+    uint32_t tokenNum = static_cast<uint32_t>((tileRowStart + rowNum - 1) / headNum - tokenStart + 1);
+    uint32_t angleNum = tokenNum * halfDim;
+
+    // angles of each token, then sin and cos of all of them in one pass of the strategy. The positions stay on
+    // the vector unit: each is broadcast to a block, which one repeat per token multiplies with inv_freq
+    AscendC::LocalTensor<float> posLocal = PreDeQueCastPos(tokenNum);
+    AscendC::LocalTensor<float> posBrcbLocal = posBrcbBuf.Get<float>();
+    uint32_t brcbRepeatNum = (tokenNum + BLOCK_ELEM_NUM - 1) / BLOCK_ELEM_NUM;
+    for (uint32_t r = 0; r < brcbRepeatNum; r += MAX_REPEAT_TIMES) {
+        uint8_t repeatTimes = static_cast<uint8_t>(min(MAX_REPEAT_TIMES, brcbRepeatNum - r));
+        AscendC::Brcb(posBrcbLocal[r * BLOCK_ELEM_NUM * BLOCK_ELEM_NUM], posLocal[r * BLOCK_ELEM_NUM], repeatTimes,
+                      {1, BLOCK_ELEM_NUM});
+    }
+    AscendC::LocalTensor<float> angleLocal = angleBuf.Get<float>();
+    // inv_freq is reused by every repeat (stride 0), the position block by every block of a repeat
+    uint8_t halfBlockNum = static_cast<uint8_t>(halfDim / BLOCK_ELEM_NUM);
+    AscendC::BinaryRepeatParams angleParams(1, 1, 0, halfBlockNum, 0, 1);
+    for (uint32_t t = 0; t < tokenNum; t += MAX_REPEAT_TIMES) {
+        uint8_t repeatTimes = static_cast<uint8_t>(min(MAX_REPEAT_TIMES, tokenNum - t));
+        for (uint32_t k = 0; k < halfDim; k += REPEAT_ELEM_NUM) {
+            uint64_t mask = min(REPEAT_ELEM_NUM, halfDim - k);
+            AscendC::Mul(angleLocal[t * halfDim + k], freqLocal[k], posBrcbLocal[t * BLOCK_ELEM_NUM], mask,
+                         repeatTimes, angleParams);
+        }
+    }
+    if constexpr (std::is_same_v<P, float>) {
+        inQueuePos.FreeTensor(posLocal);
+    }
+    AscendC::LocalTensor<float> sinLocal = sinBuf.Get<float>();
+    AscendC::LocalTensor<float> cosLocal = cosBuf.Get<float>();
+    strategy.ComputeSinCosImpl(angleLocal, sinLocal, cosLocal, angleNum);
+    // the angles are dead, they hold -sin for the x1 half of the rotation
+    AscendC::Muls(angleLocal, sinLocal, -1.0f, angleNum);
+
+    AscendC::LocalTensor<float> xLocal = PreDeQueCastX(rowNum * headDim);
+    AscendC::LocalTensor<float> yLocal = PreAllocateY();
+    for (uint32_t i = 0; i < tokenNum; i++) {
+        uint64_t tokenRowStart = max((tokenStart + i) * headNum, tileRowStart);
+        uint64_t tokenRowEnd = min((tokenStart + i + 1) * headNum, tileRowStart + rowNum);
+        RotateRows(xLocal, yLocal, cosLocal[i * halfDim], sinLocal[i * halfDim], angleLocal[i * halfDim],
+                   static_cast<uint32_t>(tokenRowStart - tileRowStart),
+                   static_cast<uint32_t>(tokenRowEnd - tokenRowStart));
+    }
+    if constexpr (std::is_same_v<T, float>) {
+        inQueueX.FreeTensor(xLocal);
+    }
+    PostCastEnQue(yLocal, rowNum * headDim);
+}
+
+template <class T, class P, class ComputeStrategy>
+__aicore__ inline void KernelCosRope<T, P, ComputeStrategy>::RotateRows(const AscendC::LocalTensor<float>& xLocal,
+                                                                        const AscendC::LocalTensor<float>& yLocal,
+                                                                        const AscendC::LocalTensor<float>& cosLocal,
+                                                                        const AscendC::LocalTensor<float>& sinLocal,
+                                                                        const AscendC::LocalTensor<float>& negSinLocal,
+                                                                        uint32_t rowOffset, uint32_t rowNum)
+{
+    // one repeat per head: x and y step a row per repeat, the token's cos/sin chunk is reused (stride 0)
+    uint8_t rowBlockNum = static_cast<uint8_t>(headDim * sizeof(float) / 32);
+    AscendC::BinaryRepeatParams repeatParams(1, 1, 1, rowBlockNum, rowBlockNum, 0);
+    for (uint32_t r = 0; r < rowNum; r += MAX_REPEAT_TIMES) {
+        uint8_t repeatTimes = static_cast<uint8_t>(min(MAX_REPEAT_TIMES, rowNum - r));
+        for (uint32_t k = 0; k < halfDim; k += REPEAT_ELEM_NUM) {
+            uint64_t mask = min(REPEAT_ELEM_NUM, halfDim - k);
+            uint32_t x1 = (rowOffset + r) * headDim + k;
+            uint32_t x2 = x1 + halfDim;
+            // y1 = x1 * cos - x2 * sin
+            AscendC::Mul(yLocal[x1], xLocal[x1], cosLocal[k], mask, repeatTimes, repeatParams);
+            AscendC::MulAddDst(yLocal[x1], xLocal[x2], negSinLocal[k], mask, repeatTimes, repeatParams);
+            // y2 = x2 * cos + x1 * sin
+            AscendC::Mul(yLocal[x2], xLocal[x2], cosLocal[k], mask, repeatTimes, repeatParams);
+            AscendC::MulAddDst(yLocal[x2], xLocal[x1], sinLocal[k], mask, repeatTimes, repeatParams);
+        }
+    }
+}
+
+template <class T, class P, class ComputeStrategy>
+__aicore__ inline void KernelCosRope<T, P, ComputeStrategy>::CopyOut(uint64_t rowStart, uint32_t rowNum)
+{
+    AscendC::LocalTensor<T> yLocal = outQueueY.DeQue<T>();
+    AscendC::DataCopy(yGm[rowStart * headDim], yLocal, rowNum * headDim);
+    outQueueY.FreeTensor(yLocal);
+}
+
+template <class T, class P, class ComputeStrategy>
+__aicore__ inline AscendC::LocalTensor<float> KernelCosRope<T, P, ComputeStrategy>::PreDeQueCastPos(uint32_t tokenNum)
+{
+    if constexpr (std::is_same_v<P, float>) {
+        AscendC::LocalTensor<float> posLocal = inQueuePos.DeQue<float>();
+        return posLocal;
+    } else {
+        AscendC::LocalTensor<float> posLocal = posBuf.Get<float>();
+        AscendC::LocalTensor<P> posOrigin = inQueuePos.DeQue<P>();
+        AscendC::Cast(posLocal, posOrigin, AscendC::RoundMode::CAST_RINT, tokenNum);
+        inQueuePos.FreeTensor(posOrigin);
+        return posLocal;
+    }
+}
+
+template <class T, class P, class ComputeStrategy>
+__aicore__ inline AscendC::LocalTensor<float> KernelCosRope<T, P, ComputeStrategy>::PreDeQueCastX(
+    uint32_t processDataNum)
+{
+    if constexpr (std::is_same_v<T, float>) {
+        AscendC::LocalTensor<float> xLocal = inQueueX.DeQue<float>();
+        return xLocal;
+    } else {
+        AscendC::LocalTensor<float> xLocal = xBuf.Get<float>();
+        AscendC::LocalTensor<T> xOrigin = inQueueX.DeQue<T>();
+        AscendC::Cast(xLocal, xOrigin, AscendC::RoundMode::CAST_NONE, processDataNum);
+        inQueueX.FreeTensor(xOrigin);
+        return xLocal;
+    }
+}
+
+template <class T, class P, class ComputeStrategy>
+__aicore__ inline AscendC::LocalTensor<float> KernelCosRope<T, P, ComputeStrategy>::PreAllocateY()
+{
+    if constexpr (std::is_same_v<T, float>) {
+        AscendC::LocalTensor<float> yLocal = outQueueY.AllocTensor<float>();
+        return yLocal;
+    } else {
+        AscendC::LocalTensor<float> yLocal = yBuf.Get<float>();
+        return yLocal;
+    }
+}
+
+template <class T, class P, class ComputeStrategy>
+__aicore__ inline void KernelCosRope<T, P, ComputeStrategy>::PostCastEnQue(AscendC::LocalTensor<float>& yLocal,
+                                                                           uint32_t processDataNum)
+{
+    if constexpr (std::is_same_v<T, float>) {
+        outQueueY.EnQue(yLocal);
+    } else {
+        AscendC::LocalTensor<T> yTarget = outQueueY.AllocTensor<T>();
+        AscendC::Cast(yTarget, yLocal, AscendC::RoundMode::CAST_RINT, processDataNum);
+        outQueueY.EnQue(yTarget);
+    }
+}
+
+extern "C" __global__ __aicore__ void cos_rope(GM_ADDR x, GM_ADDR positions, GM_ADDR inv_freq, GM_ADDR y,
+                                               GM_ADDR workspace, GM_ADDR tiling)
+{
+    GET_TILING_DATA(tiling_data, tiling);
+
+    // positions * inv_freq grows with the sequence length, so the angles take the two-stage reduction
+    KernelCosRope<DTYPE_X, DTYPE_POSITIONS, HighPrecFusedStrategy> op;
+    AscendC::TPipe pipe;
+    op.Init(x, positions, inv_freq, y,
+            tiling_data.bigCoreDataNum,
+            tiling_data.smallCoreDataNum,
+            tiling_data.tailCoreDataNum,
+            tiling_data.tileDataNum,
+            tiling_data.bigCoreNum,
+            tiling_data.headNum,
+            tiling_data.headDim,
+            tiling_data.tokenTileNum,
+            &pipe);
+    op.Process();
+}
@@ -0,0 +1,297 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * @file foreach_cos.cpp
+ */
+#include "kernel_operator.h"
+#include "cos_strategy.h"
+
+constexpr int32_t BUFFER_NUM = 2;
+constexpr uint32_t MAX_TENSOR_NUM = 64;
+
+/**
+ * Cos over a list of tensors. The core slices cut the tensors laid end to end, so a core walks its slice
+ * tensor by tensor; one tile packs as many segments as fit, each starting on a 32-byte block of UB, and
+ * runs the strategy once over all of them.
+ */
+template <class T, class ComputeStrategy>
+class KernelForeachCos
+{
+public:
+    __aicore__ inline KernelForeachCos() {}
+    __aicore__ inline void Init(GM_ADDR x, GM_ADDR y,
+                                uint64_t bigCoreDataNum,
+                                uint64_t smallCoreDataNum,
+                                uint64_t tailCoreDataNum,
+                                uint32_t tileDataNum,
+                                uint32_t bigCoreNum,
+                                uint32_t tensorNum,
+                                const uint64_t* tensorDataNum,
+                                AscendC::TPipe* pipe);
+    __aicore__ inline void Process();
+
+private:
+    template <class U>
+    static __aicore__ inline const U& min(const U& a, const U& b) { return (b < a) ? b : a; }
+
+    __aicore__ inline uint32_t NextSegment(uint32_t& tensorIdx, uint64_t& tensorOffset,
+                                           uint64_t remainDataNum, uint32_t ubFreeNum);
+    __aicore__ inline uint64_t CopyIn(uint32_t& tensorIdx, uint64_t& tensorOffset, uint64_t remainDataNum,
+                                      uint32_t& ubDataNum);
+    __aicore__ inline void Compute(uint32_t ubDataNum);
+    __aicore__ inline void CopyOut(uint32_t tensorIdx, uint64_t tensorOffset, uint64_t processDataNum);
+
+    __aicore__ inline AscendC::LocalTensor<float> PreDeQueCastX(uint32_t ubDataNum);
+    __aicore__ inline AscendC::LocalTensor<float> PreAllocateY();
+    __aicore__ inline void PostCastEnQue(AscendC::LocalTensor<float>& yLocal, uint32_t ubDataNum);
+
+private:
+    AscendC::TQue<AscendC::QuePosition::VECIN, 1> inQueueX;
+    AscendC::TQue<AscendC::QuePosition::VECOUT, 1> outQueueY;
+    AscendC::TBuf<AscendC::QuePosition::VECCALC> xBuf, yBuf;
+    AscendC::ListTensorDesc xList;
+    AscendC::ListTensorDesc yList;
+
+    uint64_t coreDataNum;
+    uint32_t tileDataNum;
+    uint64_t tensorDataNum[MAX_TENSOR_NUM];
+    // first element of the core slice
+    uint32_t startTensorIdx;
+    uint64_t startTensorOffset;
+
+    ComputeStrategy strategy;
+
+    static constexpr uint32_t BLOCK_ELEM_NUM = 32 / sizeof(T);
+};
+
+template <class T, class ComputeStrategy>
+__aicore__ inline void KernelForeachCos<T, ComputeStrategy>::Init(GM_ADDR x, GM_ADDR y,
+                                                                  uint64_t bigCoreDataNum,
+                                                                  uint64_t smallCoreDataNum,
+                                                                  uint64_t tailCoreDataNum,
+                                                                  uint32_t tileDataNum,
+                                                                  uint32_t bigCoreNum,
+                                                                  uint32_t tensorNum,
+                                                                  const uint64_t* tensorDataNum,
+                                                                  AscendC::TPipe* pipe)
+{
+    ASSERT(AscendC::GetBlockNum() != 0 && "block dim can not be zero!");
+    uint64_t globalBufferIndex = bigCoreDataNum * AscendC::GetBlockIdx();
+    if (AscendC::GetBlockIdx() < bigCoreNum) {
+        this->coreDataNum = bigCoreDataNum;
+    } else {
+        this->coreDataNum = smallCoreDataNum;
+        globalBufferIndex -= (bigCoreDataNum - smallCoreDataNum) * (AscendC::GetBlockIdx() - bigCoreNum);
+    }
+    // the last core ends exactly at the logical end of the last tensor
+    if (AscendC::GetBlockIdx() == AscendC::GetBlockNum() - 1) {
+        this->coreDataNum = tailCoreDataNum;
+    }
+    this->tileDataNum = tileDataNum;
+
+    this->startTensorIdx = 0;
+    for (uint32_t i = 0; i < tensorNum; i++) {
+        this->tensorDataNum[i] = tensorDataNum[i];
+        if (globalBufferIndex >= tensorDataNum[i] && this->startTensorIdx == i) {
+            globalBufferIndex -= tensorDataNum[i];
+            this->startTensorIdx = i + 1;
+        }
+    }
+    this->startTensorOffset = globalBufferIndex;
+
+    xList = AscendC::ListTensorDesc(reinterpret_cast<__gm__ void*>(x));
+    yList = AscendC::ListTensorDesc(reinterpret_cast<__gm__ void*>(y));
+    pipe->InitBuffer(inQueueX, BUFFER_NUM, this->tileDataNum * sizeof(T));
+    pipe->InitBuffer(outQueueY, BUFFER_NUM, this->tileDataNum * sizeof(T));
+    if constexpr (!std::is_same_v<T, float>) {
+        pipe->InitBuffer(xBuf, this->tileDataNum * sizeof(float));
+        pipe->InitBuffer(yBuf, this->tileDataNum * sizeof(float));
+    }
+    strategy.InitBufImpl(pipe, this->tileDataNum);
+}
+
+template <class T, class ComputeStrategy>
+__aicore__ inline void KernelForeachCos<T, ComputeStrategy>::Process()
+{
+    uint32_t tensorIdx = this->startTensorIdx;
+    uint64_t tensorOffset = this->startTensorOffset;
+    uint64_t remainDataNum = this->coreDataNum;
+    while (remainDataNum > 0) {
+        // CopyOut replays the segments CopyIn packed, from the same first element
+        uint32_t tileTensorIdx = tensorIdx;
+        uint64_t tileTensorOffset = tensorOffset;
+        uint32_t ubDataNum = 0;
+        uint64_t processDataNum = CopyIn(tensorIdx, tensorOffset, remainDataNum, ubDataNum);
+        Compute(ubDataNum);
+        CopyOut(tileTensorIdx, tileTensorOffset, processDataNum);
+        remainDataNum -= processDataNum;
+    }
+}
+
+/**
+ * Returns the length of the segment starting at (tensorIdx, tensorOffset), the rest of that tensor bounded
+ * by remainDataNum and ubFreeNum, and moves the cursor past it. Empty tensors are skipped.
+ */
+template <class T, class ComputeStrategy>
+__aicore__ inline uint32_t KernelForeachCos<T, ComputeStrategy>::NextSegment(uint32_t& tensorIdx,
+                                                                             uint64_t& tensorOffset,
+                                                                             uint64_t remainDataNum,
+                                                                             uint32_t ubFreeNum)
+{
+    while (tensorOffset == this->tensorDataNum[tensorIdx]) {
+        tensorIdx++;
+        tensorOffset = 0;
+    }
+    uint64_t segmentNum = min(this->tensorDataNum[tensorIdx] - tensorOffset, remainDataNum);
+    segmentNum = min(segmentNum, static_cast<uint64_t>(ubFreeNum));
+    tensorOffset += segmentNum;
+    return static_cast<uint32_t>(segmentNum);
+}
+
+/**
+ * Packs segments from the cursor into one tile until remainDataNum elements are taken or UB is full, and
+ * returns how many were taken; ubDataNum is the block-padded length the strategy runs over.
+ */
+template <class T, class ComputeStrategy>
+__aicore__ inline uint64_t KernelForeachCos<T, ComputeStrategy>::CopyIn(uint32_t& tensorIdx, uint64_t& tensorOffset,
+                                                                        uint64_t remainDataNum, uint32_t& ubDataNum)
+{
+    AscendC::LocalTensor<T> xLocal = inQueueX.AllocTensor<T>();
+    AscendC::GlobalTensor<T> xGm;
+    uint32_t ubOffset = 0;
+    uint64_t i = 0;
+    while (i < remainDataNum && ubOffset < this->tileDataNum) {
+        uint64_t segmentOffset = tensorOffset;
+        uint32_t segmentNum = NextSegment(tensorIdx, tensorOffset, remainDataNum - i, this->tileDataNum - ubOffset);
+        xGm.SetGlobalBuffer(xList.GetDataPtr<T>(tensorIdx) + segmentOffset, segmentNum);
+        if (segmentNum % BLOCK_ELEM_NUM == 0) {
+            AscendC::DataCopy(xLocal[ubOffset], xGm, segmentNum);
+        } else {
+            // zero the rest of the last block, the strategy runs over it with the other segments
+            uint8_t padNum = static_cast<uint8_t>(BLOCK_ELEM_NUM - segmentNum % BLOCK_ELEM_NUM);
+            AscendC::DataCopyExtParams copyParams{1, static_cast<uint32_t>(segmentNum * sizeof(T)), 0, 0, 0};
+            AscendC::DataCopyPadExtParams<T> padParams{true, 0, padNum, 0};
+            AscendC::DataCopyPad(xLocal[ubOffset], xGm, copyParams, padParams);
+        }
+        i += segmentNum;
+        ubOffset += (segmentNum + BLOCK_ELEM_NUM - 1) / BLOCK_ELEM_NUM * BLOCK_ELEM_NUM;
+    }
+    inQueueX.EnQue(xLocal);
+    ubDataNum = ubOffset;
+    return i;
+}
+
+template <class T, class ComputeStrategy>
+__aicore__ inline void KernelForeachCos<T, ComputeStrategy>::Compute(uint32_t ubDataNum)
+{
+    AscendC::LocalTensor<float> xLocal = PreDeQueCastX(ubDataNum);
+    AscendC::LocalTensor<float> yLocal = PreAllocateY();
+
+    strategy.ComputeImpl(xLocal, yLocal, ubDataNum);
+
+    if constexpr (std::is_same_v<T, float>) {
+        inQueueX.FreeTensor(xLocal);
+    }
+    PostCastEnQue(yLocal, ubDataNum);
+}
+
+template <class T, class ComputeStrategy>
+__aicore__ inline void KernelForeachCos<T, ComputeStrategy>::CopyOut(uint32_t tensorIdx, uint64_t tensorOffset,
+                                                                     uint64_t processDataNum)
+{
+    AscendC::LocalTensor<T> yLocal = outQueueY.DeQue<T>();
+    AscendC::GlobalTensor<T> yGm;
+    uint32_t ubOffset = 0;
+    // the same segments as CopyIn: each is cut by the same tensor end or UB bound, the last by processDataNum
+    for (uint64_t i = 0; i < processDataNum;) {
+        uint64_t segmentOffset = tensorOffset;
+        uint32_t segmentNum = NextSegment(tensorIdx, tensorOffset, processDataNum - i, this->tileDataNum - ubOffset);
+        yGm.SetGlobalBuffer(yList.GetDataPtr<T>(tensorIdx) + segmentOffset, segmentNum);
+        if (segmentNum % BLOCK_ELEM_NUM == 0) {
+            AscendC::DataCopy(yGm, yLocal[ubOffset], segmentNum);
+        } else {
+            AscendC::DataCopyExtParams copyParams{1, static_cast<uint32_t>(segmentNum * sizeof(T)), 0, 0, 0};
+            AscendC::DataCopyPad(yGm, yLocal[ubOffset], copyParams);
+        }
+        i += segmentNum;
+        ubOffset += (segmentNum + BLOCK_ELEM_NUM - 1) / BLOCK_ELEM_NUM * BLOCK_ELEM_NUM;
+    }
+    outQueueY.FreeTensor(yLocal);
+}
+
+template <class T, class ComputeStrategy>
+__aicore__ inline AscendC::LocalTensor<float> KernelForeachCos<T, ComputeStrategy>::PreDeQueCastX(uint32_t ubDataNum)
+{
+    if constexpr (std::is_same_v<T, float>) {
+        AscendC::LocalTensor<float> xLocal = inQueueX.DeQue<float>();
+        return xLocal;
+    } else {
+        AscendC::LocalTensor<float> xLocal = xBuf.Get<float>();
+        AscendC::LocalTensor<T> xOrigin = inQueueX.DeQue<T>();
+        AscendC::Cast(xLocal, xOrigin, AscendC::RoundMode::CAST_NONE, ubDataNum);
+        inQueueX.FreeTensor(xOrigin);
+        return xLocal;
+    }
+}
+
+template <class T, class ComputeStrategy>
+__aicore__ inline AscendC::LocalTensor<float> KernelForeachCos<T, ComputeStrategy>::PreAllocateY()
+{
+    if constexpr (std::is_same_v<T, float>) {
+        AscendC::LocalTensor<float> yLocal = outQueueY.AllocTensor<float>();
+        return yLocal;
+    } else {
+        AscendC::LocalTensor<float> yLocal = yBuf.Get<float>();
+        return yLocal;
+    }
+}
+
+template <class T, class ComputeStrategy>
+__aicore__ inline void KernelForeachCos<T, ComputeStrategy>::PostCastEnQue(AscendC::LocalTensor<float>& yLocal,
+                                                                           uint32_t ubDataNum)
+{
+    if constexpr (std::is_same_v<T, float>) {
+        outQueueY.EnQue(yLocal);
+    } else {
+        AscendC::LocalTensor<T> yTarget = outQueueY.AllocTensor<T>();
+        AscendC::Cast(yTarget, yLocal, AscendC::RoundMode::CAST_RINT, ubDataNum);
+        outQueueY.EnQue(yTarget);
+    }
+}
+
+template <class ComputeStrategy>
+__aicore__ inline void RunKernelForeachCos(GM_ADDR x, GM_ADDR y, const ForeachCosTilingData& tiling_data)
+{
+    KernelForeachCos<DTYPE_X, ComputeStrategy> op;
+    AscendC::TPipe pipe;
+    op.Init(x, y,
+            tiling_data.bigCoreDataNum,
+            tiling_data.smallCoreDataNum,
+            tiling_data.tailCoreDataNum,
+            tiling_data.tileDataNum,
+            tiling_data.bigCoreNum,
+            tiling_data.tensorNum,
+            tiling_data.tensorDataNum,
+            &pipe);
+    op.Process();
+}
+
+extern "C" __global__ __aicore__ void foreach_cos(GM_ADDR x, GM_ADDR y, GM_ADDR workspace, GM_ADDR tiling)
+{
+    GET_TILING_DATA(tiling_data, tiling);
+
+    // tiling keys COS_TILING_KEY_HIGH_PRECISION and COS_TILING_KEY_HIGH_PERFORMANCE of Cos
+    if (TILING_KEY_IS(1)) {
+        RunKernelForeachCos<HighPrecFusedStrategy>(x, y, tiling_data);
+    } else if (TILING_KEY_IS(2)) {
+        RunKernelForeachCos<HighPerfFusedStrategy>(x, y, tiling_data);
+    }
+}
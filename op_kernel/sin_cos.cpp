@@ -0,0 +1,219 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * @file sin_cos.cpp
+ */
+#include "kernel_operator.h"
+#include "cos_strategy.h"
+
+constexpr int32_t BUFFER_NUM = 2;
+
+template <class T, class ComputeStrategy>
+class KernelSinCos
+{
+public:
+    __aicore__ inline KernelSinCos() {}
+    __aicore__ inline void Init(GM_ADDR x, GM_ADDR ySin, GM_ADDR yCos,
+                                uint64_t bigCoreDataNum,
+                                uint64_t smallCoreDataNum,
+                                uint64_t tailCoreDataNum,
+                                uint32_t tileDataNum,
+                                uint32_t bigCoreNum,
+                                AscendC::TPipe* pipe);
+    __aicore__ inline void Process();
+
+private:
+    template <class U>
+    static __aicore__ inline const U& min(const U& a, const U& b) { return (b < a) ? b : a; }
+
+    __aicore__ inline void CopyIn(uint64_t offset, uint32_t processDataNum);
+    __aicore__ inline void Compute(uint32_t processDataNum);
+    __aicore__ inline void CopyOut(uint64_t offset, uint32_t processDataNum);
+
+    __aicore__ inline AscendC::LocalTensor<float> PreDeQueCastX(uint32_t processDataNum);
+    __aicore__ inline AscendC::LocalTensor<float> PreAllocateY(AscendC::TQue<AscendC::QuePosition::VECOUT, 1>& outQueue,
+                                                               AscendC::TBuf<AscendC::QuePosition::VECCALC>& yBuf);
+    __aicore__ inline void PostCastEnQue(AscendC::TQue<AscendC::QuePosition::VECOUT, 1>& outQueue,
+                                         AscendC::LocalTensor<float>& yLocal,
+                                         uint32_t processDataNum);
+
+private:
+    AscendC::TQue<AscendC::QuePosition::VECIN, 1> inQueueX;
+    AscendC::TQue<AscendC::QuePosition::VECOUT, 1> outQueueSin, outQueueCos;
+    AscendC::TBuf<AscendC::QuePosition::VECCALC> xBuf, sinBuf, cosBuf;
+    AscendC::GlobalTensor<T> xGm;
+    AscendC::GlobalTensor<T> sinGm;
+    AscendC::GlobalTensor<T> cosGm;
+
+    uint64_t coreDataNum;
+    uint32_t tileDataNum;
+
+    ComputeStrategy strategy;
+
+    static constexpr uint32_t BLOCK_ELEM_NUM = 32 / sizeof(T);
+};
+
+template <class T, class ComputeStrategy>
+__aicore__ inline void KernelSinCos<T, ComputeStrategy>::Init(GM_ADDR x, GM_ADDR ySin, GM_ADDR yCos,
+                                                              uint64_t bigCoreDataNum,
+                                                              uint64_t smallCoreDataNum,
+                                                              uint64_t tailCoreDataNum,
+                                                              uint32_t tileDataNum,
+                                                              uint32_t bigCoreNum,
+                                                              AscendC::TPipe* pipe)
+{
+    ASSERT(AscendC::GetBlockNum() != 0 && "block dim can not be zero!");
+    uint64_t globalBufferIndex = bigCoreDataNum * AscendC::GetBlockIdx();
+    if (AscendC::GetBlockIdx() < bigCoreNum) {
+        this->coreDataNum = bigCoreDataNum;
+    } else {
+        this->coreDataNum = smallCoreDataNum;
+        globalBufferIndex -= (bigCoreDataNum - smallCoreDataNum) * (AscendC::GetBlockIdx() - bigCoreNum);
+    }
+    // the last core ends exactly at the logical end of x
+    if (AscendC::GetBlockIdx() == AscendC::GetBlockNum() - 1) {
+        this->coreDataNum = tailCoreDataNum;
+    }
+    this->tileDataNum = tileDataNum;
+
+    xGm.SetGlobalBuffer((__gm__ T*)x + globalBufferIndex, this->coreDataNum);
+    sinGm.SetGlobalBuffer((__gm__ T*)ySin + globalBufferIndex, this->coreDataNum);
+    cosGm.SetGlobalBuffer((__gm__ T*)yCos + globalBufferIndex, this->coreDataNum);
+    pipe->InitBuffer(inQueueX, BUFFER_NUM, this->tileDataNum * sizeof(T));
+    pipe->InitBuffer(outQueueSin, BUFFER_NUM, this->tileDataNum * sizeof(T));
+    pipe->InitBuffer(outQueueCos, BUFFER_NUM, this->tileDataNum * sizeof(T));
+    if constexpr (!std::is_same_v<T, float>) {
+        pipe->InitBuffer(xBuf, this->tileDataNum * sizeof(float));
+        pipe->InitBuffer(sinBuf, this->tileDataNum * sizeof(float));
+        pipe->InitBuffer(cosBuf, this->tileDataNum * sizeof(float));
+    }
+    strategy.InitBufImpl(pipe, this->tileDataNum);
+}
+
+template <class T, class ComputeStrategy>
+__aicore__ inline void KernelSinCos<T, ComputeStrategy>::Process()
+{
+    uint64_t coreDataNum = this->coreDataNum;
+    uint64_t tileDataNum = this->tileDataNum;
+    for (uint64_t i = 0; i < coreDataNum; i += tileDataNum) {
+        uint32_t processDataNum = min(tileDataNum, coreDataNum - i);
+        CopyIn(i, processDataNum);
+        Compute(processDataNum);
+        CopyOut(i, processDataNum);
+    }
+}
+
+template <class T, class ComputeStrategy>
+__aicore__ inline void KernelSinCos<T, ComputeStrategy>::CopyIn(uint64_t offset, uint32_t processDataNum)
+{
+    AscendC::LocalTensor<T> xLocal = inQueueX.AllocTensor<T>();
+    if (processDataNum % BLOCK_ELEM_NUM == 0) {
+        AscendC::DataCopy(xLocal, xGm[offset], processDataNum);
+    } else {
+        AscendC::DataCopyExtParams copyParams{1, static_cast<uint32_t>(processDataNum * sizeof(T)), 0, 0, 0};
+        AscendC::DataCopyPadExtParams<T> padParams{false, 0, 0, 0};
+        AscendC::DataCopyPad(xLocal, xGm[offset], copyParams, padParams);
+    }
+    inQueueX.EnQue(xLocal);
+}
+
+template <class T, class ComputeStrategy>
+__aicore__ inline void KernelSinCos<T, ComputeStrategy>::Compute(uint32_t processDataNum)
+{
+    AscendC::LocalTensor<float> xLocal = PreDeQueCastX(processDataNum);
+    AscendC::LocalTensor<float> sinLocal = PreAllocateY(outQueueSin, sinBuf);
+    AscendC::LocalTensor<float> cosLocal = PreAllocateY(outQueueCos, cosBuf);
+
+    strategy.ComputeSinCosImpl(xLocal, sinLocal, cosLocal, processDataNum);
+
+    if constexpr (std::is_same_v<T, float>) {
+        inQueueX.FreeTensor(xLocal);
+    }
+    PostCastEnQue(outQueueSin, sinLocal, processDataNum);
+    PostCastEnQue(outQueueCos, cosLocal, processDataNum);
+}
+
+template <class T, class ComputeStrategy>
+__aicore__ inline void KernelSinCos<T, ComputeStrategy>::CopyOut(uint64_t offset, uint32_t processDataNum)
+{
+    AscendC::LocalTensor<T> sinLocal = outQueueSin.DeQue<T>();
+    AscendC::LocalTensor<T> cosLocal = outQueueCos.DeQue<T>();
+    if (processDataNum % BLOCK_ELEM_NUM == 0) {
+        AscendC::DataCopy(sinGm[offset], sinLocal, processDataNum);
+        AscendC::DataCopy(cosGm[offset], cosLocal, processDataNum);
+    } else {
+        AscendC::DataCopyExtParams copyParams{1, static_cast<uint32_t>(processDataNum * sizeof(T)), 0, 0, 0};
+        AscendC::DataCopyPad(sinGm[offset], sinLocal, copyParams);
+        AscendC::DataCopyPad(cosGm[offset], cosLocal, copyParams);
+    }
+    outQueueSin.FreeTensor(sinLocal);
+    outQueueCos.FreeTensor(cosLocal);
+}
+
+template <class T, class ComputeStrategy>
+__aicore__ inline AscendC::LocalTensor<float> KernelSinCos<T, ComputeStrategy>::PreDeQueCastX(uint32_t processDataNum)
+{
+    if constexpr (std::is_same_v<T, float>) {
+        AscendC::LocalTensor<float> xLocal = inQueueX.DeQue<float>();
+        return xLocal;
+    } else {
+        AscendC::LocalTensor<float> xLocal = xBuf.Get<float>();
+        AscendC::LocalTensor<T> xOrigin = inQueueX.DeQue<T>();
+        AscendC::Cast(xLocal, xOrigin, AscendC::RoundMode::CAST_NONE, processDataNum);
+        inQueueX.FreeTensor(xOrigin);
+        return xLocal;
+    }
+}
+
+template <class T, class ComputeStrategy>
+__aicore__ inline AscendC::LocalTensor<float> KernelSinCos<T, ComputeStrategy>::PreAllocateY(
+    AscendC::TQue<AscendC::QuePosition::VECOUT, 1>& outQueue,
+    AscendC::TBuf<AscendC::QuePosition::VECCALC>& yBuf)
+{
+    if constexpr (std::is_same_v<T, float>) {
+        AscendC::LocalTensor<float> yLocal = outQueue.AllocTensor<float>();
+        return yLocal;
+    } else {
+        AscendC::LocalTensor<float> yLocal = yBuf.Get<float>();
+        return yLocal;
+    }
+}
+
+template <class T, class ComputeStrategy>
+__aicore__ inline void KernelSinCos<T, ComputeStrategy>::PostCastEnQue(
+    AscendC::TQue<AscendC::QuePosition::VECOUT, 1>& outQueue,
+    AscendC::LocalTensor<float>& yLocal,
+    uint32_t processDataNum)
+{
+    if constexpr (std::is_same_v<T, float>) {
+        outQueue.EnQue(yLocal);
+    } else {
+        AscendC::LocalTensor<T> yTarget = outQueue.AllocTensor<T>();
+        AscendC::Cast(yTarget, yLocal, AscendC::RoundMode::CAST_RINT, processDataNum);
+        outQueue.EnQue(yTarget);
+    }
+}
+
+extern "C" __global__ __aicore__ void sin_cos(GM_ADDR x, GM_ADDR y_sin, GM_ADDR y_cos, GM_ADDR workspace, GM_ADDR tiling)
+{
+    GET_TILING_DATA(tiling_data, tiling);
+
+    KernelSinCos<DTYPE_X, HighPrecFusedStrategy> op;
+    AscendC::TPipe pipe;
+    op.Init(x, y_sin, y_cos,
+            tiling_data.bigCoreDataNum,
+            tiling_data.smallCoreDataNum,
+            tiling_data.tailCoreDataNum,
+            tiling_data.tileDataNum,
+            tiling_data.bigCoreNum,
+            &pipe);
+    op.Process();
+}
@@ -0,0 +1,83 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * @file cos_aicpu.cpp
+ */
+#include "cos_aicpu.h"
+#include <cstdint>
+#include <string>
+#include "cpu_kernel_utils.h"
+#include "cos_emu_impl.h"
+#include "cos_tiling_common.h"
+
+namespace {
+const char* const COS = "Cos";
+// elements per ParallelFor shard: graphs only route inputs up to COS_AICPU_MAX_DATA_NUM here, which run in
+// one shard; larger ones come when the AICPU engine is chosen explicitly, e.g. by cos_aicpu_crossover
+constexpr int64_t COS_AICPU_SHARD_DATA_NUM = optiling::COS_AICPU_MAX_DATA_NUM;
+} // namespace
+
+namespace aicpu {
+uint32_t CosCpuKernel::Compute(CpuKernelContext& ctx)
+{
+    Tensor* x = ctx.Input(0);
+    Tensor* y = ctx.Output(0);
+    if (x == nullptr || y == nullptr || x->GetData() == nullptr || y->GetData() == nullptr ||
+        x->GetDataType() != y->GetDataType() || x->NumElements() != y->NumElements()) {
+        return KERNEL_STATUS_PARAM_INVALID;
+    }
+    cosemu::DataType dtype;
+    int64_t elemSize;
+    switch (x->GetDataType()) {
+        case DT_FLOAT:
+            dtype = cosemu::DataType::FLOAT32;
+            elemSize = sizeof(float);
+            break;
+        case DT_FLOAT16:
+            dtype = cosemu::DataType::FLOAT16;
+            elemSize = sizeof(uint16_t);
+            break;
+        case DT_BFLOAT16:
+            dtype = cosemu::DataType::BFLOAT16;
+            elemSize = sizeof(uint16_t);
+            break;
+        default:
+            return KERNEL_STATUS_PARAM_INVALID;
+    }
+
+    // same precision_mode as the AI core kernel; CheckSupported keeps max_abs_input hints on AI core
+    cosemu::Strategy strategy = cosemu::Strategy::HIGH_PREC;
+    AttrValue* precisionMode = ctx.GetAttr("precision_mode");
+    if (precisionMode != nullptr) {
+        std::string mode = precisionMode->GetString();
+        if (mode == "high_performance") {
+            strategy = cosemu::Strategy::HIGH_PERF;
+        } else if (mode != "high_precision") {
+            return KERNEL_STATUS_PARAM_INVALID;
+        }
+    }
+
+    const uint8_t* src = static_cast<const uint8_t*>(x->GetData());
+    uint8_t* dst = static_cast<uint8_t*>(y->GetData());
+    auto shard = [&](int64_t start, int64_t end) {
+        cosemu::detail::CosNeon(strategy, dtype, src + start * elemSize, dst + start * elemSize,
+                                static_cast<size_t>(end - start));
+    };
+    int64_t num = x->NumElements();
+    if (num <= COS_AICPU_SHARD_DATA_NUM) {
+        shard(0, num);
+        return KERNEL_STATUS_OK;
+    }
+    return CpuKernelUtils::ParallelFor(ctx, num, COS_AICPU_SHARD_DATA_NUM, shard);
+}
+
+REGISTER_CPU_KERNEL(COS, CosCpuKernel);
+} // namespace aicpu
@@ -0,0 +1,28 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * @file cos_aicpu.h
+ */
+#ifndef COS_AICPU_H
+#define COS_AICPU_H
+#include "cpu_kernel.h"
+
+namespace aicpu {
+// Cos for the tiny tensors op_host/cos.cpp routes off AI core: HighPrecStrategy on NEON, bit-identical
+// to tiling key 5 of op_kernel/cos.cpp
+class CosCpuKernel : public CpuKernel {
+public:
+    CosCpuKernel() = default;
+    ~CosCpuKernel() override = default;
+    uint32_t Compute(CpuKernelContext& ctx) override;
+};
+} // namespace aicpu
+#endif // COS_AICPU_H
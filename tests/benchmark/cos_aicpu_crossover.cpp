@@ -0,0 +1,166 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * @file cos_aicpu_crossover.cpp
+ * Times the installed Cos custom op on the AI core and on the AICPU engine over a sweep of input sizes on
+ * the NPU, and reports the largest size at which the AICPU kernel is still faster.
+ */
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "acl/acl.h"
+#include "cos_tiling_common.h"
+
+namespace {
+struct BenchOptions {
+    aclDataType dtype = ACL_FLOAT;
+    const char* dtypeName = "float32";
+    std::vector<int64_t> nums;
+    uint32_t repeat = 200;
+    int32_t deviceId = 0;
+};
+
+#define CHECK_ACL(expr)                                                                \
+    do {                                                                               \
+        aclError ret = (expr);                                                         \
+        if (ret != ACL_SUCCESS) {                                                      \
+            fprintf(stderr, "%s failed: %d (%s)\n", #expr, ret, aclGetRecentErrMsg()); \
+            exit(1);                                                                   \
+        }                                                                              \
+    } while (0)
+
+// median wall time in us of one synchronous Cos launch of num elements on engine
+double TimeCos(const BenchOptions& opts, int64_t num, aclopEngineType engine, aclrtStream stream)
+{
+    size_t bytes = static_cast<size_t>(num) * aclDataTypeSize(opts.dtype);
+    void* xDevice = nullptr;
+    void* yDevice = nullptr;
+    CHECK_ACL(aclrtMalloc(&xDevice, bytes, ACL_MEM_MALLOC_HUGE_FIRST));
+    CHECK_ACL(aclrtMalloc(&yDevice, bytes, ACL_MEM_MALLOC_HUGE_FIRST));
+    CHECK_ACL(aclrtMemset(xDevice, bytes, 0, bytes));
+
+    int64_t dims[] = {num};
+    aclTensorDesc* xDesc = aclCreateTensorDesc(opts.dtype, 1, dims, ACL_FORMAT_ND);
+    aclTensorDesc* yDesc = aclCreateTensorDesc(opts.dtype, 1, dims, ACL_FORMAT_ND);
+    aclDataBuffer* xBuffer = aclCreateDataBuffer(xDevice, bytes);
+    aclDataBuffer* yBuffer = aclCreateDataBuffer(yDevice, bytes);
+    aclopAttr* attr = aclopCreateAttr();
+    CHECK_ACL(aclopSetAttrString(attr, "precision_mode", "high_precision"));
+
+    auto launch = [&]() {
+        CHECK_ACL(aclopCompileAndExecute("Cos", 1, &xDesc, &xBuffer, 1, &yDesc, &yBuffer, attr, engine,
+                                         ACL_COMPILE_SYS, nullptr, stream));
+        CHECK_ACL(aclrtSynchronizeStream(stream));
+    };
+    // the first launch compiles the op and fills the op cache
+    launch();
+    std::vector<double> times;
+    for (uint32_t i = 0; i < opts.repeat; i++) {
+        auto start = std::chrono::steady_clock::now();
+        launch();
+        times.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+    }
+    std::nth_element(times.begin(), times.begin() + times.size() / 2, times.end());
+
+    aclopDestroyAttr(attr);
+    aclDestroyDataBuffer(xBuffer);
+    aclDestroyDataBuffer(yBuffer);
+    aclDestroyTensorDesc(xDesc);
+    aclDestroyTensorDesc(yDesc);
+    CHECK_ACL(aclrtFree(xDevice));
+    CHECK_ACL(aclrtFree(yDevice));
+    return times[times.size() / 2];
+}
+
+void Usage(const char* name)
+{
+    fprintf(stderr,
+            "usage: %s [--dtype float32|float16|bfloat16] [--num N]... [--repeat R] [--device ID]\n"
+            "prints one JSON object per num and the crossover size on stderr\n",
+            name);
+}
+
+bool ParseArgs(int argc, char* argv[], BenchOptions& opts)
+{
+    for (int i = 1; i + 1 < argc; i += 2) {
+        std::string arg = argv[i];
+        std::string value = argv[i + 1];
+        if (arg == "--dtype") {
+            if (value == "float32") {
+                opts.dtype = ACL_FLOAT;
+            } else if (value == "float16") {
+                opts.dtype = ACL_FLOAT16;
+            } else if (value == "bfloat16") {
+                opts.dtype = ACL_BF16;
+            } else {
+                return false;
+            }
+            opts.dtypeName = argv[i + 1];
+        } else if (arg == "--num") {
+            opts.nums.push_back(strtoll(value.c_str(), nullptr, 10));
+        } else if (arg == "--repeat") {
+            opts.repeat = std::max<uint32_t>(strtoul(value.c_str(), nullptr, 10), 1);
+        } else if (arg == "--device") {
+            opts.deviceId = static_cast<int32_t>(strtol(value.c_str(), nullptr, 10));
+        } else {
+            return false;
+        }
+    }
+    return argc % 2 == 1;
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    BenchOptions opts;
+    if (!ParseArgs(argc, argv, opts)) {
+        Usage(argv[0]);
+        return 1;
+    }
+    if (opts.nums.empty()) {
+        // powers of two around the default COS_AICPU_MAX_DATA_NUM
+        for (int64_t num = 16; num <= (1 << 20); num *= 2) {
+            opts.nums.push_back(num);
+        }
+    }
+    // the AI core runs must not be turned away by the check-support routing being measured
+    setenv("COS_DISABLE", "aicpu", 1);
+
+    CHECK_ACL(aclInit(nullptr));
+    CHECK_ACL(aclrtSetDevice(opts.deviceId));
+    aclrtStream stream = nullptr;
+    CHECK_ACL(aclrtCreateStream(&stream));
+
+    int64_t crossover = 0;
+    for (int64_t num : opts.nums) {
+        double aicoreUs = TimeCos(opts, num, ACL_ENGINE_AICORE, stream);
+        double aicpuUs = TimeCos(opts, num, ACL_ENGINE_AICPU, stream);
+        if (aicpuUs < aicoreUs) {
+            crossover = std::max(crossover, num);
+        }
+        printf("{\"dtype\": \"%s\", \"input_num\": %ld, \"aicore_us\": %.1f, \"aicpu_us\": %.1f, "
+               "\"aicpu_routed\": %s}\n",
+               opts.dtypeName, num, aicoreUs, aicpuUs, optiling::CosPreferAicpu(num) ? "true" : "false");
+        fflush(stdout);
+    }
+    fprintf(stderr, "largest input_num faster on AICPU: %ld (COS_AICPU_MAX_DATA_NUM = %ld)\n", crossover,
+            optiling::COS_AICPU_MAX_DATA_NUM);
+
+    CHECK_ACL(aclrtDestroyStream(stream));
+    CHECK_ACL(aclrtResetDevice(opts.deviceId));
+    CHECK_ACL(aclFinalize());
+    return 0;
+}
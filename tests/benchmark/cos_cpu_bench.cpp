@@ -0,0 +1,379 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * @file cos_cpu_bench.cpp
+ */
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+#include "tikicpulib.h"
+#include "kernel_operator.h"
+#include "cos_tiling_common.h"
+
+#if COS_BENCH_DTYPE_ID == 0
+#define DTYPE_X float
+#define COS_BENCH_DTYPE_NAME "float32"
+#elif COS_BENCH_DTYPE_ID == 1
+#define DTYPE_X half
+#define COS_BENCH_DTYPE_NAME "float16"
+#else
+#define DTYPE_X bfloat16_t
+#define COS_BENCH_DTYPE_NAME "bfloat16"
+#endif
+// y keeps x's type (dst_type -1)
+#define DTYPE_Y DTYPE_X
+
+// generated by the op project for op_kernel/cos.cpp; the layout mirrors op_host/cos_tiling.h
+struct CosTilingData {
+    uint64_t bigCoreDataNum;
+    uint64_t smallCoreDataNum;
+    uint64_t tailCoreDataNum;
+    uint32_t tileDataNum;
+    uint32_t bigCoreNum;
+    float alpha;
+    float beta;
+    float gamma;
+    uint64_t rowLen;
+    uint32_t rowTileLen;
+    uint32_t viewDimNum;
+    uint64_t viewShape[8];
+    uint64_t viewStride[8];
+};
+#define GET_TILING_DATA(tilingData, tilingArg) \
+    CosTilingData tilingData = *reinterpret_cast<__gm__ CosTilingData*>(tilingArg)
+#ifndef TILING_KEY_IS
+#define TILING_KEY_IS(key) (false)
+#endif
+
+// the kernel entry is named cos, which clashes with ::cos of <cmath> in a host build
+#define cos cos_kernel
+#include "cos.cpp"
+#undef cos
+
+// one entry per strategy, bypassing the tiling key dispatch so that every strategy runs on one SoC
+#define COS_BENCH_KERNEL(name, strategy)                                                                  \
+    extern "C" __global__ __aicore__ void name(GM_ADDR x, GM_ADDR y, GM_ADDR workspace, GM_ADDR tiling) \
+    {                                                                                                     \
+        GET_TILING_DATA(tiling_data, tiling);                                                             \
+        RunKernelCos<strategy>(x, y, tiling_data);                                                        \
+    }
+
+COS_BENCH_KERNEL(cos_bench_ref, RefStrategy)
+#if __CCE_AICORE__ != 200
+COS_BENCH_KERNEL(cos_bench_high_perf, HighPerfStrategy)
+COS_BENCH_KERNEL(cos_bench_high_prec, HighPrecStrategy)
+COS_BENCH_KERNEL(cos_bench_high_prec_short, HighPrecShortStrategy)
+COS_BENCH_KERNEL(cos_bench_no_reduce, HighPrecNoReduceStrategy)
+COS_BENCH_KERNEL(cos_bench_high_perf_fused, HighPerfFusedStrategy)
+COS_BENCH_KERNEL(cos_bench_high_prec_fused, HighPrecFusedStrategy)
+#if COS_BENCH_DTYPE_ID != 0
+extern "C" __global__ __aicore__ void cos_bench_lut(GM_ADDR x, GM_ADDR y, GM_ADDR workspace, GM_ADDR tiling)
+{
+    GET_TILING_DATA(tiling_data, tiling);
+    RunKernelCosLut<HighPrecFusedStrategy>(x, y, workspace, tiling_data);
+}
+#endif
+#if COS_BENCH_DTYPE_ID == 1
+extern "C" __global__ __aicore__ void cos_bench_half(GM_ADDR x, GM_ADDR y, GM_ADDR workspace, GM_ADDR tiling)
+{
+    GET_TILING_DATA(tiling_data, tiling);
+    RunKernelCosHalf<HighPerfFusedStrategy>(x, y, tiling_data);
+}
+#endif
+#endif
+
+namespace {
+using CosBenchKernel = void (*)(GM_ADDR, GM_ADDR, GM_ADDR, GM_ADDR);
+
+struct BenchStrategy {
+    const char* name;
+    uint64_t tilingKey;     // key dispatching the strategy in op_kernel/cos.cpp, 0 if none on this SoC
+    CosBenchKernel kernel;
+    uint32_t tmpBufNum;
+    uint32_t vecInstrNum;
+    float maxAbsInput;      // inputs are drawn from [-maxAbsInput, maxAbsInput]
+    bool lut = false;       // KernelCosLut: the table takes UB and workspace
+};
+
+// system workspace in front of the user workspace, GetLibApiWorkSpaceSize on the device
+constexpr size_t SYS_WORKSPACE_SIZE = 16 * 1024 * 1024;
+
+const std::vector<BenchStrategy>& Strategies()
+{
+    using namespace optiling;
+    static const std::vector<BenchStrategy> strategies = {
+        {"Ref", 0, cos_bench_ref, COS_TMP_BUF_NUM_REF, COS_VEC_INSTR_NUM_REF, 1.0e4f},
+#if __CCE_AICORE__ != 200
+        {"HighPerf", COS_TILING_KEY_HIGH_PERFORMANCE_UNFUSED, cos_bench_high_perf, COS_TMP_BUF_NUM_HIGH_PERF,
+         COS_VEC_INSTR_NUM_HIGH_PERF, 1.0e4f},
+        {"HighPrec", COS_TILING_KEY_HIGH_PRECISION_UNFUSED, cos_bench_high_prec, COS_TMP_BUF_NUM_HIGH_PREC,
+         COS_VEC_INSTR_NUM_HIGH_PREC, 1.0e4f},
+        {"HighPrecShort", COS_TILING_KEY_HIGH_PRECISION_SHORT, cos_bench_high_prec_short, COS_TMP_BUF_NUM_HIGH_PREC,
+         COS_VEC_INSTR_NUM_HIGH_PREC_SHORT, COS_SHORT_REDUCE_MAX_ABS},
+        {"HighPrecNoReduce", COS_TILING_KEY_NO_REDUCTION, cos_bench_no_reduce, COS_TMP_BUF_NUM_NO_REDUCE,
+         COS_VEC_INSTR_NUM_NO_REDUCE, COS_NO_REDUCE_MAX_ABS},
+        {"HighPerfFused", COS_TILING_KEY_HIGH_PERFORMANCE, cos_bench_high_perf_fused, COS_TMP_BUF_NUM_HIGH_PERF_FUSED,
+         COS_VEC_INSTR_NUM_HIGH_PERF_FUSED, 1.0e4f},
+        {"HighPrecFused", COS_TILING_KEY_HIGH_PRECISION, cos_bench_high_prec_fused, COS_TMP_BUF_NUM_HIGH_PREC,
+         COS_VEC_INSTR_NUM_HIGH_PREC_FUSED, 1.0e4f},
+#if COS_BENCH_DTYPE_ID != 0
+        // the table of the default high_precision key
+        {"Lut", CosLutTilingKey(COS_TILING_KEY_HIGH_PRECISION), cos_bench_lut, COS_TMP_BUF_NUM_HIGH_PREC,
+         COS_VEC_INSTR_NUM_LUT, 1.0e4f, true},
+#endif
+#if COS_BENCH_DTYPE_ID == 1
+        // inputs within the half range, wider ones only time the fp32 fallback
+        {"Half", COS_TILING_KEY_HALF, cos_bench_half, CosStrategyTmpBufNum(COS_TILING_KEY_HALF, false),
+         COS_VEC_INSTR_NUM_HALF_FP32, COS_HALF_MAX_ABS},
+#endif
+#endif
+    };
+    return strategies;
+}
+
+struct BenchOptions {
+    std::vector<std::string> strategies;
+    std::vector<uint64_t> inputNums = {1024, 65537, 1048576};
+    uint32_t coreNum = 0;       // 0: split with the tiling cost model
+    uint32_t tileDataNum = 0;   // 0: largest tile UB holds
+    uint32_t repeat = 3;
+    uint64_t ubSize = 192 * 1024;
+    uint32_t maxCoreNum = 40;
+    bool timeOnly = false;
+};
+
+struct BenchResult {
+    optiling::CosSplitInfo info;
+    uint32_t ubTileNum;
+    uint64_t tileTotal;
+    uint64_t tilePerCoreMax;
+    uint64_t vecInstrTotal;
+    uint64_t vecRepeatTotal;
+    double wallUs;
+    double maxAbsErr;
+    bool inplaceMatch;
+};
+
+uint64_t CoreDataNum(const optiling::CosSplitInfo& info, uint32_t blockIdx)
+{
+    if (blockIdx == info.coreNum - 1) {
+        return info.tailCoreDataNum;
+    }
+    return (blockIdx < info.bigCoreNum) ? info.bigCoreDataNum : info.smallCoreDataNum;
+}
+
+bool RunOne(const BenchStrategy& strategy, uint64_t inputNum, const BenchOptions& opts, BenchResult& result)
+{
+    using namespace optiling;
+    const uint32_t xTypeLength = sizeof(DTYPE_X);
+    const uint32_t blockElemNum = BLOCK_SIZE / xTypeLength;
+    CosCostInfo cost = {strategy.vecInstrNum, 2, COS_BUFFER_NUM};
+    result.ubTileNum = CosUbTileNum(xTypeLength, 2, strategy.tmpBufNum);
+    uint64_t ubSize = opts.ubSize - (strategy.lut ? CosLutTableBytes(xTypeLength) : 0);
+    result.info = strategy.lut ? CosLutSplit(inputNum, xTypeLength, opts.ubSize, opts.maxCoreNum,
+                                             COS_TILING_KEY_HIGH_PRECISION) :
+                                 CosCommonSplit(inputNum, xTypeLength, ubSize, opts.maxCoreNum, result.ubTileNum, cost);
+    if (opts.coreNum != 0 || opts.tileDataNum != 0) {
+        uint32_t coreNum = (opts.coreNum != 0) ? opts.coreNum : result.info.coreNum;
+        uint32_t tileDataNum = (opts.tileDataNum != 0) ? opts.tileDataNum : result.info.tileDataNum;
+        if (tileDataNum % blockElemNum != 0 ||
+            static_cast<uint64_t>(tileDataNum) * xTypeLength * result.ubTileNum > ubSize ||
+            (inputNum + blockElemNum - 1) / blockElemNum < coreNum) {
+            fprintf(stderr, "%s: %u cores x %u elements does not fit %lu elements\n", strategy.name, coreNum,
+                    tileDataNum, static_cast<unsigned long>(inputNum));
+            return false;
+        }
+        result.info = CosSliceSplit(inputNum, blockElemNum, coreNum, tileDataNum);
+    }
+    const CosSplitInfo& info = result.info;
+
+    result.tileTotal = 0;
+    result.tilePerCoreMax = 0;
+    result.vecRepeatTotal = 0;
+    // the table kernel reads the 16-bit inputs as they are
+    uint64_t instrPerTile = strategy.vecInstrNum + ((xTypeLength == sizeof(float) || strategy.lut) ? 0 : 2);
+    for (uint32_t blockIdx = 0; blockIdx < info.coreNum; blockIdx++) {
+        uint64_t coreDataNum = CoreDataNum(info, blockIdx);
+        uint64_t tileNum = (coreDataNum + info.tileDataNum - 1) / info.tileDataNum;
+        result.tileTotal += tileNum;
+        result.tilePerCoreMax = std::max(result.tilePerCoreMax, tileNum);
+        for (uint64_t i = 0; i < coreDataNum; i += info.tileDataNum) {
+            uint64_t processDataNum = std::min<uint64_t>(info.tileDataNum, coreDataNum - i);
+            // one repeat covers 256 bytes of the float working copy
+            result.vecRepeatTotal += instrPerTile * ((processDataNum * sizeof(float) + 255) / 256);
+        }
+    }
+    result.vecInstrTotal = result.tileTotal * instrPerTile;
+
+    size_t byteSize = inputNum * xTypeLength;
+    uint8_t* x = reinterpret_cast<uint8_t*>(AscendC::GmAlloc(byteSize));
+    uint8_t* y = reinterpret_cast<uint8_t*>(AscendC::GmAlloc(byteSize));
+    // only the table kernel takes a workspace, but every ICPU_RUN_KF argument has to come from GmAlloc
+    size_t workspaceSize = strategy.lut ? SYS_WORKSPACE_SIZE + CosLutTableBytes(xTypeLength) : BLOCK_SIZE;
+    uint8_t* workspace = reinterpret_cast<uint8_t*>(AscendC::GmAlloc(workspaceSize));
+    uint8_t* tiling = reinterpret_cast<uint8_t*>(AscendC::GmAlloc(sizeof(CosTilingData)));
+    // alpha 1, beta 1, gamma 0: plain cos(x)
+    CosTilingData tilingData = {info.bigCoreDataNum, info.smallCoreDataNum, info.tailCoreDataNum, info.tileDataNum,
+                                info.bigCoreNum, 1.0f, 1.0f, 0.0f};
+    memcpy(tiling, &tilingData, sizeof(tilingData));
+    std::mt19937 gen(static_cast<uint32_t>(inputNum));
+    std::uniform_real_distribution<float> dist(-strategy.maxAbsInput, strategy.maxAbsInput);
+    DTYPE_X* xData = reinterpret_cast<DTYPE_X*>(x);
+    for (uint64_t i = 0; i < inputNum; i++) {
+        xData[i] = static_cast<DTYPE_X>(dist(gen));
+    }
+
+    std::vector<double> wallUs;
+    AscendC::SetKernelMode(KernelMode::AIV_MODE);
+    for (uint32_t r = 0; r < opts.repeat; r++) {
+        auto begin = std::chrono::steady_clock::now();
+        ICPU_RUN_KF(strategy.kernel, info.coreNum, x, y, workspace, tiling);
+        auto end = std::chrono::steady_clock::now();
+        wallUs.push_back(std::chrono::duration<double, std::micro>(end - begin).count());
+    }
+    std::sort(wallUs.begin(), wallUs.end());
+    result.wallUs = wallUs[wallUs.size() / 2];
+
+    result.maxAbsErr = 0.0;
+    const DTYPE_X* yData = reinterpret_cast<const DTYPE_X*>(y);
+    for (uint64_t i = 0; i < inputNum; i++) {
+        double expect = std::cos(static_cast<double>(static_cast<float>(xData[i])));
+        result.maxAbsErr = std::max(result.maxAbsErr, std::fabs(static_cast<float>(yData[i]) - expect));
+    }
+    // aclnnInplaceCos: the same launch with y == x has to give the out-of-place result bit for bit
+    uint8_t* xy = reinterpret_cast<uint8_t*>(AscendC::GmAlloc(byteSize));
+    memcpy(xy, x, byteSize);
+    ICPU_RUN_KF(strategy.kernel, info.coreNum, xy, xy, workspace, tiling);
+    result.inplaceMatch = (memcmp(xy, y, byteSize) == 0);
+    AscendC::GmFree(reinterpret_cast<void*>(xy));
+    AscendC::GmFree(reinterpret_cast<void*>(x));
+    AscendC::GmFree(reinterpret_cast<void*>(y));
+    AscendC::GmFree(reinterpret_cast<void*>(workspace));
+    AscendC::GmFree(reinterpret_cast<void*>(tiling));
+    return true;
+}
+
+void PrintResult(const BenchStrategy& strategy, uint64_t inputNum, const BenchResult& r)
+{
+    const uint32_t xTypeLength = sizeof(DTYPE_X);
+    printf("{\"dtype\": \"%s\", \"strategy\": \"%s\", \"tiling_key\": %lu, \"input_num\": %lu, "
+           "\"core_num\": %u, \"tile_data_num\": %u, \"ub_tile_num\": %u, \"ub_bytes\": %lu, "
+           "\"tile_total\": %lu, \"tile_per_core_max\": %lu, \"vec_instr_per_tile\": %lu, "
+           "\"vec_instr_per_elem\": %.6g, \"vec_repeat_per_elem\": %.6g, \"wall_us\": %.1f, "
+           "\"max_abs_err\": %.3g, \"inplace_match\": %s}\n",
+           COS_BENCH_DTYPE_NAME, strategy.name, static_cast<unsigned long>(strategy.tilingKey),
+           static_cast<unsigned long>(inputNum), r.info.coreNum, r.info.tileDataNum, r.ubTileNum,
+           static_cast<unsigned long>(static_cast<uint64_t>(r.ubTileNum) * r.info.tileDataNum * xTypeLength),
+           static_cast<unsigned long>(r.tileTotal), static_cast<unsigned long>(r.tilePerCoreMax),
+           static_cast<unsigned long>(r.tileTotal == 0 ? 0 : r.vecInstrTotal / r.tileTotal),
+           static_cast<double>(r.vecInstrTotal) / inputNum, static_cast<double>(r.vecRepeatTotal) / inputNum,
+           r.wallUs, r.maxAbsErr, r.inplaceMatch ? "true" : "false");
+}
+
+void Usage(const char* prog)
+{
+    fprintf(stderr,
+            "usage: %s [--strategy NAME]... [--key TILING_KEY] [--num N]... [--cores C] [--tile T]\n"
+            "          [--repeat R] [--ub-size BYTES] [--core-num C] [--time-only]\n"
+            "prints one JSON object per (strategy, num); --time-only prints the median wall time in us\n",
+            prog);
+}
+
+bool ParseOptions(int argc, char* argv[], BenchOptions& opts)
+{
+    bool customNum = false;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--time-only") {
+            opts.timeOnly = true;
+            continue;
+        }
+        if (i + 1 >= argc) {
+            return false;
+        }
+        const char* value = argv[++i];
+        if (arg == "--strategy") {
+            opts.strategies.push_back(value);
+        } else if (arg == "--key") {
+            // keys are matched without their static bucket and queue depth digits; a kernel that only
+            // carries RefStrategy runs it for every key
+            uint64_t key = strtoull(value, nullptr, 10) % optiling::COS_TILING_KEY_STATIC_STEP;
+            auto it = std::find_if(Strategies().begin(), Strategies().end(),
+                                   [key](const BenchStrategy& s) { return s.tilingKey == key; });
+            if (Strategies().size() == 1) {
+                it = Strategies().begin();
+            }
+            if (it == Strategies().end()) {
+                return false;
+            }
+            opts.strategies.push_back(it->name);
+        } else if (arg == "--num") {
+            if (!customNum) {
+                opts.inputNums.clear();
+                customNum = true;
+            }
+            opts.inputNums.push_back(strtoull(value, nullptr, 10));
+        } else if (arg == "--cores") {
+            opts.coreNum = strtoul(value, nullptr, 10);
+        } else if (arg == "--tile") {
+            opts.tileDataNum = strtoul(value, nullptr, 10);
+        } else if (arg == "--repeat") {
+            opts.repeat = std::max(1ul, strtoul(value, nullptr, 10));
+        } else if (arg == "--ub-size") {
+            opts.ubSize = strtoull(value, nullptr, 10);
+        } else if (arg == "--core-num") {
+            opts.maxCoreNum = strtoul(value, nullptr, 10);
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+} // namespace
+
+int32_t main(int32_t argc, char* argv[])
+{
+    BenchOptions opts;
+    if (!ParseOptions(argc, argv, opts)) {
+        Usage(argv[0]);
+        return 1;
+    }
+    int32_t ret = 0;
+    for (const BenchStrategy& strategy : Strategies()) {
+        if (!opts.strategies.empty() &&
+            std::find(opts.strategies.begin(), opts.strategies.end(), strategy.name) == opts.strategies.end()) {
+            continue;
+        }
+        for (uint64_t inputNum : opts.inputNums) {
+            BenchResult result;
+            if (inputNum == 0 || !RunOne(strategy, inputNum, opts, result)) {
+                ret = 1;
+                continue;
+            }
+            if (!result.inplaceMatch) {
+                ret = 1;
+            }
+            if (opts.timeOnly) {
+                printf("%.1f\n", result.wallUs);
+            } else {
+                PrintResult(strategy, inputNum, result);
+            }
+        }
+    }
+    return ret;
+}
@@ -0,0 +1,36 @@
+#!/bin/bash
+# Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+# This file is a part of the CANN Open Software.
+# Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+# Please refer to the License for details. You may not use this file except in compliance with the License.
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+# INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+# See LICENSE in the root of the software repository for the full text of the License.
+# ======================================================================================================================
+
+# usage: bash run.sh [SOC_VERSION] [OUTPUT]; extra benchmark options can be passed in COS_BENCH_ARGS
+set -e
+SOC_VERSION=${1:-Ascend910B1}
+OUTPUT=${2:-cos_bench.jsonl}
+CURRENT_DIR=$(cd "$(dirname "$0")" && pwd)
+
+if [ -n "$ASCEND_INSTALL_PATH" ]; then
+    _ASCEND_INSTALL_PATH=$ASCEND_INSTALL_PATH
+elif [ -n "$ASCEND_HOME_PATH" ]; then
+    _ASCEND_INSTALL_PATH=$ASCEND_HOME_PATH
+else
+    _ASCEND_INSTALL_PATH=/usr/local/Ascend/ascend-toolkit/latest
+fi
+source "$_ASCEND_INSTALL_PATH/bin/setenv.bash"
+export LD_LIBRARY_PATH=$_ASCEND_INSTALL_PATH/tools/tikicpulib/lib:$_ASCEND_INSTALL_PATH/tools/tikicpulib/lib/$SOC_VERSION:$LD_LIBRARY_PATH
+
+cmake -S "$CURRENT_DIR" -B "$CURRENT_DIR/build" -DSOC_VERSION="$SOC_VERSION" \
+    -DASCEND_CANN_PACKAGE_PATH="$_ASCEND_INSTALL_PATH"
+cmake --build "$CURRENT_DIR/build" -j
+
+: > "$OUTPUT"
+for bench in "$CURRENT_DIR"/build/cos_cpu_bench_*; do
+    # shellcheck disable=SC2086
+    "$bench" $COS_BENCH_ARGS >> "$OUTPUT"
+done
+echo "results written to $OUTPUT"
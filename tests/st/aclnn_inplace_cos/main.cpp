@@ -0,0 +1,272 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * @file main.cpp
+ * ST of aclnnInplaceCos: every case runs selfRef = cos(selfRef) and, on a dense copy of the same elements,
+ * the out-of-place aclnnCos with the same attributes. The two must agree bit for bit, and a strided selfRef
+ * must leave every storage element outside its view untouched, which checks the ViewCopy of the dense y back
+ * into the view that op_host/aclnn_inplace_cos.cpp relies on.
+ */
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "acl/acl.h"
+#include "aclnn_cos.h"
+#include "aclnn_inplace_cos.h"
+
+#define SUCCESS 0
+#define FAILED 1
+
+#define INFO_LOG(fmt, args...) fprintf(stdout, "[INFO]  " fmt "\n", ##args)
+#define ERROR_LOG(fmt, args...) fprintf(stderr, "[ERROR]  " fmt "\n", ##args)
+
+#define CHECK_RET(cond, return_expr) \
+    do {                             \
+        if (!(cond)) {               \
+            return_expr;             \
+        }                            \
+    } while (0)
+
+namespace {
+struct InplaceCase {
+    const char *name;
+    aclDataType dataType;
+    std::vector<int64_t> viewShape;
+    std::vector<int64_t> strides;  // in elements
+    int64_t offset;                // in elements
+    std::vector<int64_t> storageShape;
+};
+
+// 257 x 1023 keeps the 16-bit cases below the table crossover, so both runs pick the same tiling key family
+const InplaceCase CASES[] = {
+    {"dense_float", ACL_FLOAT, {257, 1023}, {1023, 1}, 0, {257, 1023}},
+    {"dense_float16", ACL_FLOAT16, {257, 1023}, {1023, 1}, 0, {257, 1023}},
+    {"dense_bfloat16", ACL_BF16, {257, 1023}, {1023, 1}, 0, {257, 1023}},
+    // every other element of each row behind a storage offset: strided rows of KernelCosView
+    {"strided_rows_float", ACL_FLOAT, {257, 1023}, {2048, 2}, 1, {257, 2048}},
+    // a transposed view: rows of a single element, the packed mode of KernelCosView
+    {"transposed_float16", ACL_FLOAT16, {1023, 257}, {1, 1023}, 0, {257, 1023}},
+};
+
+int64_t GetShapeSize(const std::vector<int64_t> &shape)
+{
+    int64_t shapeSize = 1;
+    for (auto i : shape) {
+        shapeSize *= i;
+    }
+    return shapeSize;
+}
+
+size_t ElemSize(aclDataType dataType)
+{
+    return dataType == ACL_FLOAT ? sizeof(float) : sizeof(uint16_t);
+}
+
+// uniform in [-100, 100] like Cos_case_alltype.json, stored as dataType
+std::vector<uint8_t> RandomData(aclDataType dataType, int64_t num, uint32_t seed)
+{
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<float> dist(-100.0f, 100.0f);
+    size_t elemSize = ElemSize(dataType);
+    std::vector<uint8_t> data(num * elemSize);
+    for (int64_t i = 0; i < num; i++) {
+        float v = dist(gen);
+        if (dataType == ACL_FLOAT) {
+            memcpy(&data[i * elemSize], &v, elemSize);
+        } else if (dataType == ACL_FLOAT16) {
+            aclFloat16 h = aclFloatToFloat16(v);
+            memcpy(&data[i * elemSize], &h, elemSize);
+        } else {
+            // bfloat16: round the fp32 bits to nearest even, no NaN in the range
+            uint32_t bits;
+            memcpy(&bits, &v, sizeof(bits));
+            uint16_t b = static_cast<uint16_t>((bits + 0x7FFFu + ((bits >> 16) & 1u)) >> 16);
+            memcpy(&data[i * elemSize], &b, elemSize);
+        }
+    }
+    return data;
+}
+
+// storage index of every view element, in row-major view order
+std::vector<int64_t> ViewIndices(const InplaceCase &c)
+{
+    std::vector<int64_t> indices(GetShapeSize(c.viewShape));
+    std::vector<int64_t> pos(c.viewShape.size(), 0);
+    for (size_t i = 0; i < indices.size(); i++) {
+        int64_t index = c.offset;
+        for (size_t d = 0; d < pos.size(); d++) {
+            index += pos[d] * c.strides[d];
+        }
+        indices[i] = index;
+        for (size_t d = pos.size(); d-- > 0;) {
+            if (++pos[d] < c.viewShape[d]) {
+                break;
+            }
+            pos[d] = 0;
+        }
+    }
+    return indices;
+}
+
+int Init(int32_t deviceId, aclrtStream *stream)
+{
+    auto ret = aclInit(nullptr);
+    CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("aclInit failed. ERROR: %d", ret); return FAILED);
+    ret = aclrtSetDevice(deviceId);
+    CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("aclrtSetDevice failed. ERROR: %d", ret); return FAILED);
+    ret = aclrtCreateStream(stream);
+    CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("aclrtCreateStream failed. ERROR: %d", ret); return FAILED);
+    return SUCCESS;
+}
+
+int CopyToDevice(const std::vector<uint8_t> &hostData, void **deviceAddr)
+{
+    auto ret = aclrtMalloc(deviceAddr, hostData.size(), ACL_MEM_MALLOC_HUGE_FIRST);
+    CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("aclrtMalloc failed. ERROR: %d", ret); return FAILED);
+    ret = aclrtMemcpy(*deviceAddr, hostData.size(), hostData.data(), hostData.size(), ACL_MEMCPY_HOST_TO_DEVICE);
+    CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("aclrtMemcpy failed. ERROR: %d", ret); return FAILED);
+    return SUCCESS;
+}
+
+int CopyToHost(const void *deviceAddr, std::vector<uint8_t> &hostData)
+{
+    auto ret = aclrtMemcpy(hostData.data(), hostData.size(), deviceAddr, hostData.size(), ACL_MEMCPY_DEVICE_TO_HOST);
+    CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("copy result from device to host failed. ERROR: %d", ret);
+              return FAILED);
+    return SUCCESS;
+}
+
+// runs the second phase of an aclnn call with its workspace and waits for it
+int Launch(aclnnStatus (*run)(void *, uint64_t, aclOpExecutor *, aclrtStream), uint64_t workspaceSize,
+           aclOpExecutor *executor, aclrtStream stream)
+{
+    void *workspaceAddr = nullptr;
+    if (workspaceSize > 0) {
+        auto ret = aclrtMalloc(&workspaceAddr, workspaceSize, ACL_MEM_MALLOC_HUGE_FIRST);
+        CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("allocate workspace failed. ERROR: %d", ret); return FAILED);
+    }
+    auto ret = run(workspaceAddr, workspaceSize, executor, stream);
+    if (ret == ACL_SUCCESS) {
+        ret = aclrtSynchronizeStream(stream);
+    }
+    if (workspaceSize > 0) {
+        aclrtFree(workspaceAddr);
+    }
+    CHECK_RET(ret == ACL_SUCCESS, ERROR_LOG("launch failed. ERROR: %d", ret); return FAILED);
+    return SUCCESS;
+}
+
+int RunCase(const InplaceCase &c, aclrtStream stream)
+{
+    size_t elemSize = ElemSize(c.dataType);
+    std::vector<uint8_t> storage = RandomData(c.dataType, GetShapeSize(c.storageShape), 2025);
+    std::vector<int64_t> indices = ViewIndices(c);
+    std::vector<uint8_t> dense(indices.size() * elemSize);
+    for (size_t i = 0; i < indices.size(); i++) {
+        memcpy(&dense[i * elemSize], &storage[indices[i] * elemSize], elemSize);
+    }
+
+    void *storageAddr = nullptr;
+    void *xAddr = nullptr;
+    void *yAddr = nullptr;
+    CHECK_RET(CopyToDevice(storage, &storageAddr) == SUCCESS, return FAILED);
+    CHECK_RET(CopyToDevice(dense, &xAddr) == SUCCESS, return FAILED);
+    CHECK_RET(CopyToDevice(dense, &yAddr) == SUCCESS, return FAILED);
+    std::vector<int64_t> denseStrides(c.viewShape.size(), 1);
+    for (size_t d = c.viewShape.size() - 1; d > 0; d--) {
+        denseStrides[d - 1] = denseStrides[d] * c.viewShape[d];
+    }
+    aclTensor *selfRef = aclCreateTensor(c.viewShape.data(), c.viewShape.size(), c.dataType, c.strides.data(),
+                                         c.offset, ACL_FORMAT_ND, c.storageShape.data(), c.storageShape.size(),
+                                         storageAddr);
+    aclTensor *x = aclCreateTensor(c.viewShape.data(), c.viewShape.size(), c.dataType, denseStrides.data(), 0,
+                                   ACL_FORMAT_ND, c.viewShape.data(), c.viewShape.size(), xAddr);
+    aclTensor *y = aclCreateTensor(c.viewShape.data(), c.viewShape.size(), c.dataType, denseStrides.data(), 0,
+                                   ACL_FORMAT_ND, c.viewShape.data(), c.viewShape.size(), yAddr);
+
+    // default attributes of both interfaces: high_precision, no range hint, plain cos of x's type
+    char precisionMode[] = "high_precision";
+    uint64_t workspaceSize = 0;
+    aclOpExecutor *executor = nullptr;
+    int result = FAILED;
+    auto ret = aclnnInplaceCosGetWorkspaceSize(selfRef, precisionMode, 0.0, &workspaceSize, &executor);
+    if (ret == ACL_SUCCESS && Launch(aclnnInplaceCos, workspaceSize, executor, stream) == SUCCESS) {
+        ret = aclnnCosGetWorkspaceSize(x, precisionMode, 0.0, -1, 1.0, 1.0, 0.0, y, &workspaceSize, &executor);
+        if (ret == ACL_SUCCESS && Launch(aclnnCos, workspaceSize, executor, stream) == SUCCESS) {
+            result = SUCCESS;
+        }
+    }
+    if (result != SUCCESS) {
+        ERROR_LOG("%s: aclnn call failed. ERROR: %d", c.name, ret);
+    }
+
+    std::vector<uint8_t> inplace(storage.size());
+    std::vector<uint8_t> expect(dense.size());
+    if (result == SUCCESS && CopyToHost(storageAddr, inplace) == SUCCESS && CopyToHost(yAddr, expect) == SUCCESS) {
+        // inside the view: the out-of-place result; outside it: the input, untouched
+        std::vector<uint8_t> golden(storage);
+        for (size_t i = 0; i < indices.size(); i++) {
+            memcpy(&golden[indices[i] * elemSize], &expect[i * elemSize], elemSize);
+        }
+        size_t mismatch = 0;
+        for (size_t i = 0; i < golden.size(); i += elemSize) {
+            if (memcmp(&golden[i], &inplace[i], elemSize) != 0 && mismatch++ < 5) {
+                ERROR_LOG("%s: storage element %zu differs from the out-of-place run", c.name, i / elemSize);
+            }
+        }
+        result = (mismatch == 0) ? SUCCESS : FAILED;
+        INFO_LOG("%s: %zu of %zu storage elements differ", c.name, mismatch, golden.size() / elemSize);
+    } else {
+        result = FAILED;
+    }
+
+    aclDestroyTensor(selfRef);
+    aclDestroyTensor(x);
+    aclDestroyTensor(y);
+    aclrtFree(storageAddr);
+    aclrtFree(xAddr);
+    aclrtFree(yAddr);
+    return result;
+}
+} // namespace
+
+int main()
+{
+    int32_t deviceId = 0;
+    aclrtStream stream;
+    auto ret = Init(deviceId, &stream);
+    CHECK_RET(ret == SUCCESS, ERROR_LOG("Init acl failed. ERROR: %d", ret); return FAILED);
+
+    // Atlas inference products have no bfloat16
+    const char *socName = aclrtGetSocName();
+    bool bf16 = socName == nullptr || strncmp(socName, "Ascend310P", strlen("Ascend310P")) != 0;
+    int failed = 0;
+    for (const InplaceCase &c : CASES) {
+        if (c.dataType == ACL_BF16 && !bf16) {
+            INFO_LOG("%s: skipped on %s", c.name, socName);
+            continue;
+        }
+        failed += (RunCase(c, stream) == SUCCESS) ? 0 : 1;
+    }
+
+    aclrtDestroyStream(stream);
+    aclrtResetDevice(deviceId);
+    aclFinalize();
+    if (failed > 0) {
+        ERROR_LOG("%d of %zu cases failed", failed, sizeof(CASES) / sizeof(CASES[0]));
+        return FAILED;
+    }
+    INFO_LOG("test pass");
+    return SUCCESS;
+}
@@ -0,0 +1,37 @@
+#!/usr/bin/python3
+# coding=utf-8
+#
+# Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+# This file is a part of the CANN Open Software.
+# Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+# Please refer to the License for details. You may not use this file except in compliance with the License.
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+# INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+# See LICENSE in the root of the software repository for the full text of the License.
+# ======================================================================================================================
+
+import tensorflow as tf
+import numpy as np
+
+
+def cos_test(x):
+    tensor = tf.convert_to_tensor(x)
+    cos_tensor = tf.math.cos(tensor)
+    re = cos_tensor.numpy()
+    return re
+
+
+def calc_expect_func(x, y, dst_type=-1, alpha=1.0, beta=1.0, gamma=0.0):
+    """
+    calc_expect_func
+    """
+    value = x['value']
+    # dst_type float: the kernel computes on the widened input and writes fp32 without rounding to x's type
+    if y['dtype'] == 'float' and x['dtype'] != 'float':
+        value = value.astype(np.float32)
+    if alpha == 1.0 and beta == 1.0 and gamma == 0.0:
+        return [cos_test(value)]
+    # the kernel applies beta, gamma and alpha in fp32 around the strategy and rounds to y's type once
+    arg = value.astype(np.float32) * np.float32(beta) + np.float32(gamma)
+    res = np.float32(alpha) * cos_test(arg)
+    return [res.astype(value.dtype)]
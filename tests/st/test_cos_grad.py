@@ -0,0 +1,26 @@
+#!/usr/bin/python3
+# coding=utf-8
+#
+# Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+# This file is a part of the CANN Open Software.
+# Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+# Please refer to the License for details. You may not use this file except in compliance with the License.
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+# INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+# See LICENSE in the root of the software repository for the full text of the License.
+# ======================================================================================================================
+
+import numpy as np
+
+
+def calc_expect_func(dy, x, sin_x, dx):
+    """
+    calc_expect_func
+    """
+    # with sin_x given the kernel takes it as sin(x) and does not read x
+    if sin_x.get('value') is not None:
+        sin = sin_x['value'].astype(np.float32)
+    else:
+        sin = np.sin(x['value'].astype(np.float64))
+    res = -dy['value'].astype(np.float32) * sin
+    return [res.astype(dy['value'].dtype)]
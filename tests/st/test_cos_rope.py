@@ -0,0 +1,30 @@
+#!/usr/bin/python3
+# coding=utf-8
+#
+# Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+# This file is a part of the CANN Open Software.
+# Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+# Please refer to the License for details. You may not use this file except in compliance with the License.
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+# INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+# See LICENSE in the root of the software repository for the full text of the License.
+# ======================================================================================================================
+
+import numpy as np
+
+
+def calc_expect_func(x, positions, inv_freq, y):
+    """
+    calc_expect_func
+    """
+    value = x['value'].astype(np.float32)
+    head_dim = value.shape[-1]
+    rows = value.reshape(positions['value'].size, -1, head_dim)
+    # the kernel rounds each angle to fp32 before the reduction, the reference takes sin/cos of the same angles
+    angle = positions['value'].reshape(-1, 1).astype(np.float32) * inv_freq['value'].reshape(1, -1)
+    cos = np.cos(angle.astype(np.float64))[:, None, :]
+    sin = np.sin(angle.astype(np.float64))[:, None, :]
+    x1 = rows[..., :head_dim // 2]
+    x2 = rows[..., head_dim // 2:]
+    res = np.concatenate([x1 * cos - x2 * sin, x2 * cos + x1 * sin], axis=-1)
+    return [res.reshape(value.shape).astype(x['value'].dtype)]
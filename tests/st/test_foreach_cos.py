@@ -0,0 +1,25 @@
+#!/usr/bin/python3
+# coding=utf-8
+#
+# Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+# This file is a part of the CANN Open Software.
+# Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+# Please refer to the License for details. You may not use this file except in compliance with the License.
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+# INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+# See LICENSE in the root of the software repository for the full text of the License.
+# ======================================================================================================================
+
+import numpy as np
+
+
+def calc_expect_func(**kwargs):
+    """
+    calc_expect_func
+    """
+    # the dynamic input x arrives as x0, x1, ...; y0, y1, ... are returned in the same order
+    res = []
+    while 'x%d' % len(res) in kwargs:
+        value = kwargs['x%d' % len(res)]['value']
+        res.append(np.cos(value.astype(np.float64)).astype(value.dtype))
+    return res
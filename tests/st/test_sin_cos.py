@@ -0,0 +1,29 @@
+#!/usr/bin/python3
+# coding=utf-8
+#
+# Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+# This file is a part of the CANN Open Software.
+# Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+# Please refer to the License for details. You may not use this file except in compliance with the License.
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+# INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+# See LICENSE in the root of the software repository for the full text of the License.
+# ======================================================================================================================
+
+import tensorflow as tf
+import numpy as np
+
+
+def sin_cos_test(x):
+    tensor = tf.convert_to_tensor(x)
+    sin_tensor = tf.math.sin(tensor)
+    cos_tensor = tf.math.cos(tensor)
+    return sin_tensor.numpy(), cos_tensor.numpy()
+
+
+def calc_expect_func(x, y_sin, y_cos):
+    """
+    calc_expect_func
+    """
+    res_sin, res_cos = sin_cos_test(x['value'])
+    return [res_sin, res_cos]
@@ -0,0 +1,624 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * @file test_cos_tiling.cpp
+ */
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdlib>
+#include <algorithm>
+#include <vector>
+#include "cos_debug_switch.h"
+#include "cos_tiling_common.h"
+#include "cos_tuned_tiling.h"
+
+using namespace optiling;
+
+namespace {
+constexpr uint64_t UB_SIZE_910B = 192 * 1024;
+constexpr uint32_t CORE_NUM_910B = 40;
+// HighPrecFusedStrategy with double-buffered x and y queues
+constexpr CosCostInfo COST_HIGH_PREC = {COS_VEC_INSTR_NUM_HIGH_PREC_FUSED, 2, COS_BUFFER_NUM};
+
+// replays the per-core offsets computed by KernelCos::Init
+uint64_t CoreOffset(const CosSplitInfo& info, uint32_t blockIdx)
+{
+    uint64_t offset = info.bigCoreDataNum * blockIdx;
+    if (blockIdx >= info.bigCoreNum) {
+        offset -= (info.bigCoreDataNum - info.smallCoreDataNum) * (blockIdx - info.bigCoreNum);
+    }
+    return offset;
+}
+
+void CheckSplitCovers(uint64_t inputNum, uint32_t xTypeLength)
+{
+    CosSplitInfo info = CosCommonSplit(inputNum, xTypeLength, UB_SIZE_910B, CORE_NUM_910B, 16, COST_HIGH_PREC);
+    uint32_t alignDataNum = info.alignDataNum;
+
+    ASSERT_GE(info.coreNum, 1u);
+    ASSERT_LE(info.coreNum, CORE_NUM_910B);
+    ASSERT_LT(info.bigCoreNum, info.coreNum);
+    // slices are cut at 32-byte blocks or at 512-byte GM bursts
+    ASSERT_TRUE(alignDataNum == BLOCK_SIZE / xTypeLength || alignDataNum == COS_GM_BURST_SIZE / xTypeLength);
+    EXPECT_EQ(info.bigCoreDataNum - info.smallCoreDataNum, alignDataNum);
+    EXPECT_EQ(info.smallCoreDataNum % alignDataNum, 0u);
+
+    EXPECT_LE(info.tailCoreDataNum, info.smallCoreDataNum);
+    EXPECT_LT(info.smallCoreDataNum - info.tailCoreDataNum, alignDataNum);
+
+    uint64_t expectOffset = 0;
+    for (uint32_t blockIdx = 0; blockIdx < info.coreNum; blockIdx++) {
+        ASSERT_EQ(CoreOffset(info, blockIdx), expectOffset) << "blockIdx " << blockIdx;
+        if (blockIdx == info.coreNum - 1) {
+            expectOffset += info.tailCoreDataNum;
+        } else {
+            expectOffset += (blockIdx < info.bigCoreNum) ? info.bigCoreDataNum : info.smallCoreDataNum;
+        }
+    }
+    // the last core ends exactly at the end of the tensor
+    EXPECT_EQ(expectOffset, inputNum);
+}
+
+// core count of the former min(coreNum, sqrt(0.375 * blocks)) rule, kept as the baseline of the cost model
+uint32_t SqrtHeuristicCoreNum(uint64_t inputNum, uint32_t xTypeLength)
+{
+    uint64_t inputBlockNum = (inputNum * xTypeLength + BLOCK_SIZE - 1) / BLOCK_SIZE;
+    return std::max(std::min(CORE_NUM_910B, static_cast<uint32_t>(std::sqrt(0.375 * inputBlockNum))), 1u);
+}
+} // namespace
+
+TEST(CosTiling, SmallInputUsesFewCores)
+{
+    CosSplitInfo info = CosCommonSplit(100, 4, UB_SIZE_910B, CORE_NUM_910B, 8, COST_HIGH_PREC);
+    EXPECT_EQ(info.coreNum, 2u);
+    EXPECT_EQ(info.tileDataNum, UB_SIZE_910B / 8 / 4);
+    CheckSplitCovers(100, 4);
+    CheckSplitCovers(1, 2);
+}
+
+TEST(CosTiling, UnalignedSizesEndOnLastElement)
+{
+    for (uint64_t inputNum = 1; inputNum < 2048; inputNum += 7) {
+        SCOPED_TRACE(inputNum);
+        CheckSplitCovers(inputNum, 4);
+        CheckSplitCovers(inputNum, 2);
+    }
+    CosSplitInfo info = CosCommonSplit(1000 * 999, 2, UB_SIZE_910B, CORE_NUM_910B, 16, COST_HIGH_PREC);
+    EXPECT_EQ(info.smallCoreDataNum - info.tailCoreDataNum, (info.alignDataNum - 999000 % info.alignDataNum));
+}
+
+TEST(CosTiling, SplitAroundUint32Limit)
+{
+    const uint64_t sizes[] = {
+        (1ULL << 32) - 1, 1ULL << 32, (1ULL << 32) + 1, (1ULL << 32) + 17, 3000000007ULL, (1ULL << 34) + 12345,
+    };
+    for (uint64_t inputNum : sizes) {
+        SCOPED_TRACE(inputNum);
+        CheckSplitCovers(inputNum, 4);
+        CheckSplitCovers(inputNum, 2);
+    }
+}
+
+TEST(CosTiling, LargeInputKeepsSlicesBalanced)
+{
+    uint64_t inputNum = (1ULL << 33) + 5;
+    CosSplitInfo info = CosCommonSplit(inputNum, 2, UB_SIZE_910B, CORE_NUM_910B, 16, COST_HIGH_PREC);
+    EXPECT_EQ(info.coreNum, CORE_NUM_910B);
+    EXPECT_GT(info.smallCoreDataNum, static_cast<uint64_t>(UINT32_MAX) / CORE_NUM_910B);
+    // slices differ by at most one 32-byte block or 512-byte burst
+    EXPECT_EQ(info.bigCoreDataNum - info.smallCoreDataNum, info.alignDataNum);
+    EXPECT_LE(info.alignDataNum, COS_GM_BURST_SIZE / 2);
+}
+
+TEST(CosTiling, StaticBucketHandlesLargeInput)
+{
+    uint64_t inputNum = 40ULL * 65536;
+    CosSplitInfo info = CosCommonSplit(inputNum, 4, UB_SIZE_910B, CORE_NUM_910B, 8, COST_HIGH_PREC);
+    EXPECT_EQ(CosStaticBucket(inputNum, CORE_NUM_910B, info), COS_STATIC_BUCKET_NUM);
+
+    // far more elements than any bucket can spread over the available cores
+    inputNum = 1ULL << 32;
+    info = CosCommonSplit(inputNum, 4, UB_SIZE_910B, CORE_NUM_910B, 8, COST_HIGH_PREC);
+    EXPECT_EQ(CosStaticBucket(inputNum, CORE_NUM_910B, info), 0u);
+}
+
+TEST(CosTiling, MaxAbsInputSelectsCheaperStrategy)
+{
+    EXPECT_EQ(CosRangeTilingKey(COS_TILING_KEY_HIGH_PRECISION, 0.0f), COS_TILING_KEY_HIGH_PRECISION);
+    EXPECT_EQ(CosRangeTilingKey(COS_TILING_KEY_HIGH_PRECISION, 100.0f), COS_TILING_KEY_HIGH_PRECISION_SHORT);
+    EXPECT_EQ(CosRangeTilingKey(COS_TILING_KEY_HIGH_PRECISION, 8192.0f), COS_TILING_KEY_HIGH_PRECISION_SHORT);
+    EXPECT_EQ(CosRangeTilingKey(COS_TILING_KEY_HIGH_PRECISION, 8193.0f), COS_TILING_KEY_HIGH_PRECISION);
+    EXPECT_EQ(CosRangeTilingKey(COS_TILING_KEY_HIGH_PERFORMANCE, 100.0f), COS_TILING_KEY_HIGH_PERFORMANCE);
+    EXPECT_EQ(CosRangeTilingKey(COS_TILING_KEY_HIGH_PRECISION, 0.5f), COS_TILING_KEY_NO_REDUCTION);
+    EXPECT_EQ(CosRangeTilingKey(COS_TILING_KEY_HIGH_PERFORMANCE, 0.5f), COS_TILING_KEY_NO_REDUCTION);
+    EXPECT_EQ(CosRangeTilingKey(COS_TILING_KEY_HIGH_PRECISION, -1.0f), COS_TILING_KEY_HIGH_PRECISION);
+}
+
+TEST(CosTiling, AffineBoundsReducedArgument)
+{
+    EXPECT_FALSE(CosIsAffine(1.0f, 1.0f, 0.0f));
+    EXPECT_TRUE(CosIsAffine(2.0f, 1.0f, 0.0f));
+    EXPECT_TRUE(CosIsAffine(1.0f, -1.0f, 0.0f));
+    EXPECT_TRUE(CosIsAffine(1.0f, 1.0f, 0.5f));
+    // unbounded stays unbounded, otherwise the strategy sees |beta * x + gamma|
+    EXPECT_EQ(CosAffineMaxAbs(0.0f, 100.0f, 1.0f), 0.0f);
+    EXPECT_EQ(CosAffineMaxAbs(0.5f, -2.0f, 0.25f), 1.25f);
+    EXPECT_EQ(CosRangeTilingKey(COS_TILING_KEY_HIGH_PRECISION, CosAffineMaxAbs(0.5f, 1.0f, 0.0f)),
+              COS_TILING_KEY_NO_REDUCTION);
+    EXPECT_EQ(CosRangeTilingKey(COS_TILING_KEY_HIGH_PRECISION, CosAffineMaxAbs(0.5f, 1.0f, 1.0f)),
+              COS_TILING_KEY_HIGH_PRECISION_SHORT);
+    EXPECT_EQ(CosRangeTilingKey(COS_TILING_KEY_HIGH_PRECISION, CosAffineMaxAbs(100.0f, 1000.0f, 0.0f)),
+              COS_TILING_KEY_HIGH_PRECISION);
+}
+
+TEST(CosTiling, TinyInputPrefersAicpu)
+{
+    EXPECT_TRUE(CosPreferAicpu(1));
+    EXPECT_TRUE(CosPreferAicpu(COS_AICPU_MAX_DATA_NUM));
+    EXPECT_FALSE(CosPreferAicpu(COS_AICPU_MAX_DATA_NUM + 1));
+    // empty tensors and the unknown size of a dynamic shape stay on AI core
+    EXPECT_FALSE(CosPreferAicpu(0));
+    EXPECT_FALSE(CosPreferAicpu(-1));
+}
+
+TEST(CosTiling, BufferNumFollowsSizeAndDtype)
+{
+    // HighPrecFusedStrategy: one buffer per queue frees room for a 40% longer fp32 tile
+    EXPECT_EQ(CosUbTileNum(4, 2, COS_TMP_BUF_NUM_HIGH_PREC, COS_SINGLE_BUFFER_NUM), 5u);
+    EXPECT_EQ(CosUbTileNum(4, 2, COS_TMP_BUF_NUM_HIGH_PREC), 7u);
+    EXPECT_EQ(CosUbTileNum(2, 2, COS_TMP_BUF_NUM_HIGH_PREC, COS_TRIPLE_BUFFER_NUM), 16u);
+
+    auto selectBufferNum = [](uint64_t inputNum, uint32_t xTypeLength) {
+        return CosSelectBufferNum(inputNum, xTypeLength, UB_SIZE_910B, CORE_NUM_910B, 2, COS_TMP_BUF_NUM_HIGH_PREC,
+                                  COS_VEC_INSTR_NUM_HIGH_PREC_FUSED);
+    };
+    // one tile per core
+    EXPECT_EQ(selectBufferNum(1, 4), COS_SINGLE_BUFFER_NUM);
+    EXPECT_EQ(selectBufferNum(40ULL * 9000, 4), COS_SINGLE_BUFFER_NUM);
+    EXPECT_EQ(selectBufferNum(40ULL * 8000, 2), COS_SINGLE_BUFFER_NUM);
+    // several tiles per core: fp32 stays double buffered, long 16-bit streams go to three buffers
+    EXPECT_EQ(selectBufferNum(1ULL << 26, 4), COS_BUFFER_NUM);
+    EXPECT_EQ(selectBufferNum(1ULL << 26, 2), COS_TRIPLE_BUFFER_NUM);
+    EXPECT_EQ(selectBufferNum(40ULL * 20000, 2), COS_BUFFER_NUM);
+
+    // every depth still fits into UB and keeps the split covering the tensor
+    for (uint64_t inputNum : {1ULL, 4097ULL, 40ULL * 9000 + 3, (1ULL << 26) + 5}) {
+        for (uint32_t xTypeLength : {2u, 4u}) {
+            uint32_t bufferNum = selectBufferNum(inputNum, xTypeLength);
+            uint32_t ubTileNum = CosUbTileNum(xTypeLength, 2, COS_TMP_BUF_NUM_HIGH_PREC, bufferNum);
+            CosSplitInfo info = CosCommonSplit(inputNum, xTypeLength, UB_SIZE_910B, CORE_NUM_910B, ubTileNum,
+                                               {COS_VEC_INSTR_NUM_HIGH_PREC_FUSED, 2, bufferNum});
+            EXPECT_LE(static_cast<uint64_t>(info.tileDataNum) * xTypeLength * ubTileNum, UB_SIZE_910B);
+            CheckSplitCovers(inputNum, xTypeLength);
+        }
+    }
+}
+
+TEST(CosTiling, CostModelPartitionsSweep)
+{
+    for (uint32_t xTypeLength : {4u, 2u}) {
+        uint32_t prevCoreNum = 1;
+        for (uint64_t inputNum = 16; inputNum <= (1ULL << 30); inputNum *= 4) {
+            SCOPED_TRACE(inputNum);
+            CosSplitInfo info = CosCommonSplit(inputNum, xTypeLength, UB_SIZE_910B, CORE_NUM_910B, 16, COST_HIGH_PREC);
+            uint64_t cycles = CosEstimateSplit(info, xTypeLength, COST_HIGH_PREC);
+            uint32_t sqrtCoreNum = SqrtHeuristicCoreNum(inputNum, xTypeLength);
+            // never worse than the block split with the heuristic core count under the same model
+            CosSplitInfo sqrtInfo = CosSliceSplit(inputNum, BLOCK_SIZE / xTypeLength, sqrtCoreNum, info.tileDataNum);
+            EXPECT_LE(cycles, CosEstimateSplit(sqrtInfo, xTypeLength, COST_HIGH_PREC));
+            // larger inputs never run on fewer cores
+            EXPECT_GE(info.coreNum, prevCoreNum);
+            prevCoreNum = info.coreNum;
+            CheckSplitCovers(inputNum, xTypeLength);
+        }
+        EXPECT_EQ(prevCoreNum, CORE_NUM_910B);
+    }
+
+    // launch and per-core setup dominate tensors of a few bursts
+    EXPECT_EQ(CosCommonSplit(64, 4, UB_SIZE_910B, CORE_NUM_910B, 16, COST_HIGH_PREC).coreNum, 1u);
+    // mid-size tensors spread wider than the square root rule allowed
+    for (uint32_t xTypeLength : {4u, 2u}) {
+        CosSplitInfo info = CosCommonSplit(16384, xTypeLength, UB_SIZE_910B, CORE_NUM_910B, 16, COST_HIGH_PREC);
+        EXPECT_GT(info.coreNum, SqrtHeuristicCoreNum(16384, xTypeLength));
+    }
+    // a memory-light strategy has less vector work to spread over the same tensor
+    CosCostInfo noReduce = {COS_VEC_INSTR_NUM_NO_REDUCE, 2, COS_BUFFER_NUM};
+    EXPECT_LE(CosCommonSplit(16384, 4, UB_SIZE_910B, CORE_NUM_910B, 16, noReduce).coreNum,
+              CosCommonSplit(16384, 4, UB_SIZE_910B, CORE_NUM_910B, 16, COST_HIGH_PREC).coreNum);
+}
+
+TEST(CosTiling, TunedTableOverridesHeuristic)
+{
+    constexpr uint32_t soc = COS_TUNED_SOC_ASCEND910B;
+    const CosTunedTiling table[] = {
+        {soc, 2, COS_TILING_KEY_HIGH_PRECISION, 20, COS_TILING_KEY_HIGH_PRECISION_UNFUSED, 24, 4096},
+        {soc, 4, COS_TILING_KEY_HIGH_PERFORMANCE, 20, COS_TILING_KEY_HIGH_PRECISION, 24, 4096},
+        {soc, 4, COS_TILING_KEY_HIGH_PRECISION, 21, COS_TILING_KEY_HIGH_PRECISION, 64, 2048},
+        {soc, 4, COS_TILING_KEY_HIGH_PRECISION, 22, COS_TILING_KEY_HIGH_PRECISION, 16, 32768},
+    };
+    const size_t tableNum = sizeof(table) / sizeof(table[0]);
+    EXPECT_EQ(CosSizeLog2(1), 0u);
+    EXPECT_EQ(CosSizeLog2((1ULL << 20) + 7), 20u);
+    EXPECT_EQ(CosSizeLog2((1ULL << 21) - 1), 20u);
+
+    // keyed by SoC, dtype, mode and size bucket
+    uint64_t inputNum = (1ULL << 20) + 7;
+    const CosTunedTiling* tuned = CosFindTunedTiling(table, tableNum, COS_TUNED_SOC_ASCEND910B, 2,
+                                                     COS_TILING_KEY_HIGH_PRECISION, inputNum);
+    ASSERT_EQ(tuned, &table[0]);
+    EXPECT_EQ(CosFindTunedTiling(table, tableNum, COS_TUNED_SOC_ASCEND310P, 2, COS_TILING_KEY_HIGH_PRECISION,
+                                 inputNum), nullptr);
+    EXPECT_EQ(CosFindTunedTiling(table, tableNum, COS_TUNED_SOC_ASCEND910B, 2, COS_TILING_KEY_HIGH_PRECISION,
+                                 1ULL << 21), nullptr);
+    // an entry may not trade high_performance for another mode's strategy
+    EXPECT_EQ(CosFindTunedTiling(table, tableNum, COS_TUNED_SOC_ASCEND910B, 4, COS_TILING_KEY_HIGH_PERFORMANCE,
+                                 inputNum), nullptr);
+    EXPECT_EQ(CosFindTunedTiling(table, 0, COS_TUNED_SOC_ASCEND910B, 2, COS_TILING_KEY_HIGH_PRECISION, inputNum),
+              nullptr);
+
+    CosSplitInfo info = {};
+    uint32_t ubTileNum = CosUbTileNum(2, 2, CosStrategyTmpBufNum(tuned->tilingKey, false));
+    ASSERT_TRUE(CosTunedSplit(*tuned, inputNum, UB_SIZE_910B, CORE_NUM_910B, ubTileNum, info));
+    EXPECT_EQ(info.coreNum, 24u);
+    EXPECT_EQ(info.tileDataNum, 4096u);
+    EXPECT_EQ(info.alignDataNum, COS_GM_BURST_SIZE / 2);
+    EXPECT_EQ(CoreOffset(info, info.coreNum - 1) + info.tailCoreDataNum, inputNum);
+
+    // entries that do not fit the launch fall back to the heuristic: too many cores, tile overflowing UB
+    CosSplitInfo untouched = info;
+    ubTileNum = CosUbTileNum(4, 2, COS_TMP_BUF_NUM_HIGH_PREC);
+    EXPECT_FALSE(CosTunedSplit(table[2], 1ULL << 21, UB_SIZE_910B, CORE_NUM_910B, ubTileNum, info));
+    EXPECT_FALSE(CosTunedSplit(table[3], 1ULL << 22, UB_SIZE_910B, CORE_NUM_910B, ubTileNum, info));
+    EXPECT_EQ(info.coreNum, untouched.coreNum);
+    EXPECT_EQ(info.tileDataNum, untouched.tileDataNum);
+    // fewer blocks than tuned cores
+    EXPECT_FALSE(CosTunedSplit(table[0], 100, UB_SIZE_910B, CORE_NUM_910B, ubTileNum, info));
+}
+
+TEST(CosTiling, CheckedInTunedTableFits)
+{
+    for (const CosTunedTiling& tuned : COS_TUNED_TILING) {
+        SCOPED_TRACE(tuned.sizeLog2);
+        bool refOnly = (tuned.soc == COS_TUNED_SOC_ASCEND310P);
+        uint64_t ubSize = refOnly ? 256 * 1024 : UB_SIZE_910B;
+        uint32_t coreNum = refOnly ? 8 : CORE_NUM_910B;
+        uint32_t ubTileNum = CosUbTileNum(tuned.xTypeLength, 2, CosStrategyTmpBufNum(tuned.tilingKey, refOnly));
+        const CosTunedTiling* found = CosFindTunedTiling(COS_TUNED_TILING.data(), COS_TUNED_TILING.size(), tuned.soc,
+                                                         tuned.xTypeLength, tuned.modeKey, 1ULL << tuned.sizeLog2);
+        EXPECT_EQ(found, &tuned);
+        CosSplitInfo info;
+        EXPECT_TRUE(CosTunedSplit(tuned, 1ULL << tuned.sizeLog2, ubSize, coreNum, ubTileNum, info));
+    }
+}
+
+TEST(CosTiling, LutPaysOffOnLarge16BitInputs)
+{
+    // the table of every key 1 to 6 is built in tiles of that key's strategy
+    for (uint64_t tableKey = COS_TILING_KEY_HIGH_PRECISION; tableKey <= COS_TILING_KEY_HIGH_PERFORMANCE_UNFUSED;
+         tableKey++) {
+        uint64_t lutKey = CosLutTilingKey(tableKey);
+        EXPECT_EQ(lutKey % COS_TILING_KEY_STATIC_STEP, COS_TILING_KEY_LUT);
+        EXPECT_EQ(CosStrategyVecInstrNum(lutKey, false), COS_VEC_INSTR_NUM_LUT);
+        EXPECT_EQ(CosStrategyTmpBufNum(lutKey, false), CosStrategyTmpBufNum(tableKey, false));
+    }
+    uint32_t ubTileNum = CosUbTileNum(2, 2, CosStrategyTmpBufNum(COS_TILING_KEY_HIGH_PRECISION, false));
+    for (uint64_t inputNum : {1ULL << 10, 1ULL << 16, 1ULL << 20, 1ULL << 28}) {
+        SCOPED_TRACE(inputNum);
+        CosSplitInfo lut = CosLutSplit(inputNum, 2, UB_SIZE_910B, CORE_NUM_910B, COS_TILING_KEY_HIGH_PRECISION);
+        EXPECT_EQ(CoreOffset(lut, lut.coreNum - 1) + lut.tailCoreDataNum, inputNum);
+        // the tiles of HighPrecFusedStrategy and the whole table share UB
+        uint64_t ubUsed = static_cast<uint64_t>(lut.tileDataNum) * 2 * ubTileNum;
+        EXPECT_LE(ubUsed + CosLutTableBytes(2), UB_SIZE_910B);
+
+        CosSplitInfo poly = CosCommonSplit(inputNum, 2, UB_SIZE_910B, CORE_NUM_910B, ubTileNum, COST_HIGH_PREC);
+        bool lutCheaper = CosEstimateLut(lut, 2, COS_TILING_KEY_HIGH_PRECISION) <
+                          CosEstimateSplit(poly, 2, COST_HIGH_PREC);
+        // building the table costs about as much as a launch of a few hundred thousand elements
+        EXPECT_EQ(lutCheaper, inputNum >= (1ULL << 20));
+    }
+}
+
+TEST(CosTiling, HalfKeyOnlyForFp16HighPerformance)
+{
+    EXPECT_EQ(CosHalfTilingKey(COS_TILING_KEY_HIGH_PERFORMANCE, true), COS_TILING_KEY_HALF);
+    EXPECT_EQ(CosHalfTilingKey(COS_TILING_KEY_HIGH_PERFORMANCE, false), COS_TILING_KEY_HIGH_PERFORMANCE);
+    // high_precision, range hints and the unfused debug keys stay on fp32
+    for (uint64_t key : {COS_TILING_KEY_HIGH_PRECISION, COS_TILING_KEY_HIGH_PRECISION_SHORT,
+                         COS_TILING_KEY_NO_REDUCTION, COS_TILING_KEY_HIGH_PERFORMANCE_UNFUSED}) {
+        EXPECT_EQ(CosHalfTilingKey(key, true), key);
+    }
+
+    // the half scratch comes on top of the float buffers of the fp32 fallback
+    uint32_t halfTileNum = CosUbTileNum(2, 2, CosStrategyTmpBufNum(COS_TILING_KEY_HALF, false));
+    uint32_t perfTileNum = CosUbTileNum(2, 2, CosStrategyTmpBufNum(COS_TILING_KEY_HIGH_PERFORMANCE, false));
+    EXPECT_EQ(halfTileNum, perfTileNum + COS_TMP_BUF_NUM_HALF);
+
+    CosCostInfo halfCost = {CosStrategyVecInstrNum(COS_TILING_KEY_HALF, false), 2, COS_BUFFER_NUM};
+    CosCostInfo perfCost = {CosStrategyVecInstrNum(COS_TILING_KEY_HIGH_PERFORMANCE, false), 2, COS_BUFFER_NUM};
+    for (uint64_t inputNum : {1ULL << 12, 1ULL << 18, 1ULL << 24}) {
+        SCOPED_TRACE(inputNum);
+        CosSplitInfo half = CosCommonSplit(inputNum, 2, UB_SIZE_910B, CORE_NUM_910B, halfTileNum, halfCost);
+        CosSplitInfo perf = CosCommonSplit(inputNum, 2, UB_SIZE_910B, CORE_NUM_910B, perfTileNum, perfCost);
+        EXPECT_EQ(CoreOffset(half, half.coreNum - 1) + half.tailCoreDataNum, inputNum);
+        EXPECT_LE(static_cast<uint64_t>(half.tileDataNum) * 2 * halfTileNum, UB_SIZE_910B);
+        EXPECT_LE(CosEstimateSplit(half, 2, halfCost), CosEstimateSplit(perf, 2, perfCost));
+    }
+}
+
+TEST(CosTiling, CollapsesStridedViews)
+{
+    CosViewInfo view;
+    // contiguous, with a size-1 dim in between
+    const int64_t denseShape[] = {4, 1, 5};
+    const int64_t denseStride[] = {5, 5, 1};
+    ASSERT_TRUE(CosCollapseView(denseShape, denseStride, 3, view));
+    EXPECT_EQ(view.dimNum, 0U);
+
+    // x[:, :, :3] of a 2x6x5 tensor: the rows stay 3 long, the two outer dims merge
+    const int64_t sliceShape[] = {2, 6, 3};
+    const int64_t sliceStride[] = {30, 5, 1};
+    ASSERT_TRUE(CosCollapseView(sliceShape, sliceStride, 3, view));
+    ASSERT_EQ(view.dimNum, 1U);
+    EXPECT_EQ(view.rowLen, 3U);
+    EXPECT_EQ(view.shape[0], 12U);
+    EXPECT_EQ(view.stride[0], 5U);
+
+    // transpose of a 4x5 tensor: no stride-1 dim, rows are single elements
+    const int64_t transShape[] = {5, 4};
+    const int64_t transStride[] = {1, 5};
+    ASSERT_TRUE(CosCollapseView(transShape, transStride, 2, view));
+    ASSERT_EQ(view.dimNum, 2U);
+    EXPECT_EQ(view.rowLen, 1U);
+    EXPECT_EQ(view.shape[1], 4U);
+    EXPECT_EQ(view.stride[1], 5U);
+
+    const int64_t negStride[] = {-5, 1};
+    EXPECT_FALSE(CosCollapseView(transShape, negStride, 2, view));
+
+    // x[..., :6] of a 2x1x3x1x4x1x5x1x8 tensor: 9 dims, but the size-1 ones drop and the outer ones merge
+    const int64_t rank9Shape[] = {2, 1, 3, 1, 4, 1, 5, 1, 6};
+    const int64_t rank9Stride[] = {480, 480, 160, 160, 40, 40, 8, 8, 1};
+    ASSERT_TRUE(CosCollapseView(rank9Shape, rank9Stride, 9, view));
+    ASSERT_EQ(view.dimNum, 1U);
+    EXPECT_EQ(view.rowLen, 6U);
+    EXPECT_EQ(view.shape[0], 120U);
+    EXPECT_EQ(view.stride[0], 8U);
+
+    // every other element of every dim of a rank-10 tensor: nine outer dims remain, one too many
+    int64_t sparseShape[10];
+    int64_t sparseStride[10];
+    for (int64_t i = 0, stride = 1; i < 10; i++, stride *= 4) {
+        sparseShape[9 - i] = 2;
+        sparseStride[9 - i] = stride;
+    }
+    EXPECT_FALSE(CosCollapseView(sparseShape, sparseStride, 10, view));
+}
+
+TEST(CosTiling, ViewSplitReadsEveryElementOnce)
+{
+    struct ViewCase {
+        std::vector<int64_t> shape;
+        std::vector<int64_t> stride;
+    };
+    const std::vector<ViewCase> cases = {
+        {{64, 1000}, {1024, 1}},       // column slice, rows padded in UB
+        {{3, 100000}, {200000, 1}},    // rows longer than a tile
+        {{300, 7, 16}, {1, 300, 2100}}, // permuted, no stride-1 dim
+        {{8, 50, 32}, {4096, 64, 1}},   // rows at two strides
+        {{5000, 6}, {0, 1}},            // broadcast rows overlapping in memory
+    };
+    for (uint32_t xTypeLength : {2U, 4U}) {
+        for (const ViewCase& c : cases) {
+            SCOPED_TRACE(c.shape.size());
+            CosViewInfo view;
+            ASSERT_TRUE(CosCollapseView(c.shape.data(), c.stride.data(), static_cast<uint32_t>(c.shape.size()), view));
+            ASSERT_NE(view.dimNum, 0U);
+            uint32_t rowTileLen = 0;
+            CosSplitInfo info = CosViewSplit(view, xTypeLength, xTypeLength, COS_TMP_BUF_NUM_HIGH_PREC, UB_SIZE_910B,
+                                             CORE_NUM_910B, rowTileLen);
+            // single-element rows: a 32-byte block per element in the x queue, then the packed tile
+            uint32_t castBufNum = (xTypeLength == sizeof(float)) ? 0 : 2;
+            uint64_t elemBytes = (view.rowLen == 1) ?
+                COS_BUFFER_NUM * (BLOCK_SIZE + xTypeLength) + xTypeLength + sizeof(uint32_t) +
+                    (castBufNum + COS_TMP_BUF_NUM_HIGH_PREC) * sizeof(float) :
+                static_cast<uint64_t>(xTypeLength) * CosUbTileNum(xTypeLength, 2, COS_TMP_BUF_NUM_HIGH_PREC);
+            EXPECT_LE(info.tileDataNum * elemBytes, UB_SIZE_910B);
+            EXPECT_EQ(view.rowLen == 1, rowTileLen == 1);
+            EXPECT_LE(info.coreNum, CORE_NUM_910B);
+
+            // replay KernelCosView: y index -> x offset of every element, against the uncollapsed strides
+            uint32_t blockElemNum = BLOCK_SIZE / xTypeLength;
+            uint64_t rowTileAlignNum = (rowTileLen + blockElemNum - 1) / blockElemNum * blockElemNum;
+            ASSERT_LE(rowTileAlignNum, info.tileDataNum);
+            uint64_t chunkNum = (view.rowLen + rowTileLen - 1) / rowTileLen;
+            uint64_t inputNum = 1;
+            for (int64_t dim : c.shape) {
+                inputNum *= dim;
+            }
+            std::vector<int64_t> xOffset(inputNum, -1);
+            for (uint32_t core = 0; core < info.coreNum; core++) {
+                uint64_t unitNum = (core < info.bigCoreNum) ? info.bigCoreDataNum : info.smallCoreDataNum;
+                for (uint64_t unit = CoreOffset(info, core); unit < CoreOffset(info, core) + unitNum; unit++) {
+                    uint64_t row = unit / chunkNum;
+                    uint64_t col = unit % chunkNum * rowTileLen;
+                    uint64_t rowOffset = 0;
+                    for (uint64_t i = view.dimNum, r = row; i > 0; i--) {
+                        rowOffset += (r % view.shape[i - 1]) * view.stride[i - 1];
+                        r /= view.shape[i - 1];
+                    }
+                    for (uint64_t j = col; j < std::min<uint64_t>(col + rowTileLen, view.rowLen); j++) {
+                        ASSERT_EQ(xOffset[row * view.rowLen + j], -1);
+                        xOffset[row * view.rowLen + j] = static_cast<int64_t>(rowOffset + j);
+                    }
+                }
+            }
+            for (uint64_t i = 0; i < inputNum; i++) {
+                int64_t expected = 0;
+                for (int64_t d = static_cast<int64_t>(c.shape.size()) - 1, r = i; d >= 0; d--) {
+                    expected += (r % c.shape[d]) * c.stride[d];
+                    r /= c.shape[d];
+                }
+                ASSERT_EQ(xOffset[i], expected) << i;
+            }
+        }
+    }
+}
+
+TEST(CosTiling, DstTypeSplitFitsUb)
+{
+    for (uint32_t typeLength : {2U, 4U}) {
+        for (uint32_t tmpBufNum : {0U, 2U, 3U}) {
+            for (uint32_t bufferNum : {1U, 2U, 3U}) {
+                EXPECT_EQ(CosUbTileNumCast(typeLength, typeLength, tmpBufNum, bufferNum),
+                          CosUbTileNum(typeLength, 2, tmpBufNum, bufferNum));
+            }
+        }
+    }
+    // x and y queues of their own types, one float buffer per 16-bit side, counted in the narrower type
+    const uint32_t pairs[][2] = {{2, 4}, {4, 2}};
+    for (const auto& pair : pairs) {
+        uint32_t xTypeLength = pair[0];
+        uint32_t yTypeLength = pair[1];
+        uint32_t ubTileNum = CosUbTileNumCast(xTypeLength, yTypeLength, COS_TMP_BUF_NUM_HIGH_PREC);
+        CosSplitInfo info = CosCommonSplit(1000003, 2, UB_SIZE_910B, CORE_NUM_910B, ubTileNum, COST_HIGH_PREC);
+        EXPECT_EQ(CoreOffset(info, info.coreNum - 1) + info.tailCoreDataNum, 1000003U);
+        uint64_t elemBytes = COS_BUFFER_NUM * (xTypeLength + yTypeLength) +
+                             sizeof(float) * (1 + COS_TMP_BUF_NUM_HIGH_PREC);
+        uint64_t tileBytes = static_cast<uint64_t>(info.tileDataNum) * elemBytes;
+        EXPECT_LE(tileBytes, UB_SIZE_910B);
+        // slices start on 32-byte blocks of both x and y
+        for (uint32_t core = 0; core < info.coreNum; core++) {
+            EXPECT_EQ(CoreOffset(info, core) * 2 % BLOCK_SIZE, 0U);
+        }
+    }
+}
+
+TEST(CosTiling, RopeSplitFitsUbAndCoversRows)
+{
+    const uint32_t shapes[][3] = {{1, 32, 128}, {7, 32, 128}, {4096, 8, 64}, {3, 1, 16}, {100, 64, 256}, {1, 1, 2032}};
+    for (const auto& shape : shapes) {
+        for (uint32_t xTypeLength : {2U, 4U}) {
+            uint32_t tokenNum = shape[0];
+            uint32_t headNum = shape[1];
+            uint32_t headDim = shape[2];
+            uint32_t tokenTileNum = 0;
+            CosSplitInfo info = CosRopeSplit(tokenNum, headNum, headDim, xTypeLength, 4, UB_SIZE_910B,
+                                             CORE_NUM_910B, tokenTileNum);
+            uint64_t rowNum = static_cast<uint64_t>(tokenNum) * headNum;
+            ASSERT_GE(info.tileDataNum, 1U);
+            EXPECT_EQ(info.coreNum, std::min<uint64_t>(rowNum, CORE_NUM_910B));
+            EXPECT_EQ(CoreOffset(info, info.coreNum - 1) + info.tailCoreDataNum, rowNum);
+            // every tile of rows, wherever it starts, touches no more tokens than the kernel keeps angles for
+            for (uint64_t rowStart = 0; rowStart < headNum; rowStart++) {
+                uint64_t rowEnd = std::min<uint64_t>(rowStart + info.tileDataNum, rowNum);
+                EXPECT_LE((rowEnd - 1) / headNum - rowStart / headNum + 1, tokenTileNum);
+            }
+            uint64_t castBytes = (xTypeLength == 4) ? 0 : 2 * sizeof(float);
+            uint64_t rowBytes = headDim * (2 * COS_BUFFER_NUM * xTypeLength + castBytes);
+            uint64_t tokenBytes = headDim / 2 * (3 + COS_TMP_BUF_NUM_HIGH_PREC) * sizeof(float);
+            uint64_t posBytes = (tokenTileNum * 4 + BLOCK_SIZE - 1) / BLOCK_SIZE * BLOCK_SIZE;
+            uint64_t brcbBytes = (tokenTileNum + 7) / 8 * 8 * BLOCK_SIZE;
+            uint64_t ubBytes = info.tileDataNum * rowBytes + tokenTileNum * tokenBytes +
+                               (COS_BUFFER_NUM + 1) * posBytes + brcbBytes + headDim / 2 * sizeof(float);
+            EXPECT_LE(ubBytes, UB_SIZE_910B) << tokenNum << "x" << headNum << "x" << headDim;
+        }
+    }
+}
+
+TEST(CosTiling, CisSplitFitsUbWithDoubleWidthOutput)
+{
+    for (uint64_t inputNum : {1ULL, 1000ULL, 65536ULL, 3ULL * 1000 * 7, 1ULL << 24}) {
+        for (uint32_t xTypeLength : {2U, 4U}) {
+            CosSplitInfo info = CosCisSplit(inputNum, xTypeLength, UB_SIZE_910B, CORE_NUM_910B);
+            ASSERT_GE(info.tileDataNum, 1U);
+            EXPECT_EQ(info.tileDataNum % (BLOCK_SIZE / xTypeLength), 0U);
+            EXPECT_EQ(CoreOffset(info, info.coreNum - 1) + info.tailCoreDataNum, inputNum);
+            uint64_t castBytes = (xTypeLength == 4) ? 0 : sizeof(float);
+            uint64_t elemBytes = COS_BUFFER_NUM * (xTypeLength + COS_CIS_Y_TYPE_LENGTH) + castBytes +
+                                 (2 + 2 + COS_TMP_BUF_NUM_HIGH_PREC) * sizeof(float);
+            EXPECT_LE(info.tileDataNum * elemBytes, UB_SIZE_910B) << inputNum << " " << xTypeLength;
+            // y is wider than the y_sin/y_cos pair of SinCos, so the tile never outgrows that of SinCos
+            uint32_t sinCosTileNum = CosUbTileNum(xTypeLength, 3, COS_TMP_BUF_NUM_HIGH_PREC);
+            CosSplitInfo sinCos = CosCommonSplit(inputNum, xTypeLength, UB_SIZE_910B, CORE_NUM_910B, sinCosTileNum,
+                                                 {COS_VEC_INSTR_NUM_SIN_COS, 3, COS_BUFFER_NUM});
+            EXPECT_LE(info.tileDataNum, sinCos.tileDataNum);
+        }
+    }
+}
+
+TEST(CosTiling, ForeachSplitWalksEveryElementOnce)
+{
+    const std::vector<std::vector<uint64_t>> lists = {
+        {1}, {1000, 0, 7, 4096, 33}, std::vector<uint64_t>(COS_FOREACH_MAX_TENSOR_NUM, 3000),
+        {0, 0, 100000, 1, 0}, {1 << 20, 17, 1 << 18}};
+    for (const auto& tensorDataNum : lists) {
+        for (uint32_t xTypeLength : {2U, 4U}) {
+            uint32_t tensorNum = static_cast<uint32_t>(tensorDataNum.size());
+            CosSplitInfo info = CosForeachSplit(tensorDataNum.data(), tensorNum, xTypeLength, UB_SIZE_910B,
+                                                CORE_NUM_910B, COS_TILING_KEY_HIGH_PRECISION);
+            uint32_t blockElemNum = BLOCK_SIZE / xTypeLength;
+            std::vector<std::vector<uint8_t>> covered(tensorNum);
+            for (uint32_t i = 0; i < tensorNum; i++) {
+                covered[i].assign(tensorDataNum[i], 0);
+            }
+            // replays KernelForeachCos::Init and the CopyIn walk of Process
+            for (uint32_t blockIdx = 0; blockIdx < info.coreNum; blockIdx++) {
+                uint64_t offset = CoreOffset(info, blockIdx);
+                uint64_t remain = (blockIdx == info.coreNum - 1) ? info.tailCoreDataNum :
+                                  (blockIdx < info.bigCoreNum) ? info.bigCoreDataNum : info.smallCoreDataNum;
+                uint32_t tensorIdx = 0;
+                while (tensorIdx < tensorNum && offset >= tensorDataNum[tensorIdx]) {
+                    offset -= tensorDataNum[tensorIdx++];
+                }
+                while (remain > 0) {
+                    uint32_t ubOffset = 0;
+                    while (remain > 0 && ubOffset < info.tileDataNum) {
+                        while (offset == tensorDataNum[tensorIdx]) {
+                            tensorIdx++;
+                            offset = 0;
+                        }
+                        uint64_t segmentNum = std::min({tensorDataNum[tensorIdx] - offset, remain,
+                                                        static_cast<uint64_t>(info.tileDataNum - ubOffset)});
+                        for (uint64_t j = 0; j < segmentNum; j++) {
+                            covered[tensorIdx][offset + j]++;
+                        }
+                        offset += segmentNum;
+                        remain -= segmentNum;
+                        ubOffset += (segmentNum + blockElemNum - 1) / blockElemNum * blockElemNum;
+                    }
+                    ASSERT_LE(ubOffset, info.tileDataNum);
+                }
+            }
+            for (uint32_t i = 0; i < tensorNum; i++) {
+                for (uint64_t j = 0; j < tensorDataNum[i]; j++) {
+                    ASSERT_EQ(covered[i][j], 1) << "tensor " << i << " element " << j;
+                }
+            }
+        }
+    }
+}
+
+TEST(CosTiling, DebugSwitchMatchesWholeNames)
+{
+    unsetenv("COS_DISABLE");
+    EXPECT_FALSE(CosFeatureDisabled(CosFeature::LUT));
+    setenv("COS_DISABLE", "static_tiling,lut", 1);
+    EXPECT_TRUE(CosFeatureDisabled(CosFeature::STATIC_TILING));
+    EXPECT_TRUE(CosFeatureDisabled(CosFeature::LUT));
+    EXPECT_FALSE(CosFeatureDisabled(CosFeature::TUNED_TILING));
+    // prefixes, empty items and unknown names match nothing
+    setenv("COS_DISABLE", "lu,,fused,aicpu_x,half_strategy", 1);
+    EXPECT_FALSE(CosFeatureDisabled(CosFeature::LUT));
+    EXPECT_FALSE(CosFeatureDisabled(CosFeature::FUSED_STRATEGY));
+    EXPECT_FALSE(CosFeatureDisabled(CosFeature::AICPU));
+    EXPECT_TRUE(CosFeatureDisabled(CosFeature::HALF_STRATEGY));
+    unsetenv("COS_DISABLE");
+}
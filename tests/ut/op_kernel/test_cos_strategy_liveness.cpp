@@ -0,0 +1,363 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * @file test_cos_strategy_liveness.cpp
+ */
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <regex>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "cos_tiling_common.h"
+
+using namespace optiling;
+
+namespace {
+// one vector instruction of a strategy: the value it defines and the values it reads
+struct Instr {
+    std::string dst;
+    std::vector<std::string> srcs;
+    bool accumulate;
+};
+
+// a strategy member function: its "name = buffer" aliasing table and instruction sequence
+struct Schedule {
+    std::string cls;
+    std::string fn;
+    std::map<std::string, std::string> alias;
+    std::vector<Instr> instrs;
+    std::set<uint32_t> tmpBufs;
+};
+
+// values a function hands on to the next one besides the result of its last instruction
+const std::map<std::string, std::set<std::string>> EXTRA_LIVE_OUT = {
+    {"HighPrecStrategy::ReducePolyImpl", {"n2", "sin_poly_8", "cos_poly_7"}},
+    {"HighPrecStrategy::SinSelectImpl", {"n2", "sin_poly_8", "cos_poly_7"}},
+    {"HighPrecShortStrategy::ShortReducePolyImpl", {"n2", "sin_poly_8", "cos_poly_7"}},
+    {"HighPrecFusedStrategy::FusedReducePolyImpl", {"n2", "sin_poly_8", "cos_poly_7"}},
+};
+
+std::string ReadStrategySource()
+{
+    std::ifstream file(COS_STRATEGY_PATH);
+    std::stringstream ss;
+    ss << file.rdbuf();
+    return ss.str();
+}
+
+std::string Trim(const std::string& s)
+{
+    size_t begin = s.find_first_not_of(" \t");
+    size_t end = s.find_last_not_of(" \t");
+    return (begin == std::string::npos) ? "" : s.substr(begin, end - begin + 1);
+}
+
+std::vector<Schedule> ParseSchedules(const std::string& src)
+{
+    std::vector<Schedule> schedules;
+    const std::regex funcRe(R"(inline void (\w+)::(\w+)\()");
+    const std::regex aliasRe(R"(LocalTensor<\w+>& (\w+) = (\w+))");
+    const std::regex instrRe(R"(^\s*AscendC::(\w+)\((.*)\);)");
+    const std::regex getRe(R"(tmpBuf(\d+)\.Get)");
+    for (auto it = std::sregex_iterator(src.begin(), src.end(), funcRe); it != std::sregex_iterator(); ++it) {
+        size_t begin = src.find("\n{", it->position());
+        size_t end = src.find("\n}", begin);
+        Schedule s{(*it)[1], (*it)[2], {}, {}, {}};
+        std::stringstream body(src.substr(begin, end - begin));
+        std::string line;
+        std::smatch m;
+        while (std::getline(body, line)) {
+            if (std::regex_search(line, m, getRe)) {
+                s.tmpBufs.insert(std::stoul(m[1]));
+            }
+            if (std::regex_search(line, m, aliasRe)) {
+                s.alias[m[1]] = m[2];
+            } else if (std::regex_search(line, m, instrRe)) {
+                std::vector<std::string> args;
+                std::stringstream argStream(m[2]);
+                std::string arg;
+                while (std::getline(argStream, arg, ',')) {
+                    args.push_back(Trim(arg));
+                }
+                // Axpy and MulAddDst add onto whatever dst holds, resolved by ResolveAccumulators
+                std::string op = m[1];
+                Instr instr{args[0], {}, op == "Axpy" || op == "MulAddDst"};
+                for (size_t i = 1; i < args.size(); i++) {
+                    // a source may be read through another view, e.g. n_magic.ReinterpretCast<uint16_t>()
+                    std::string value = args[i].substr(0, args[i].find('.'));
+                    if (s.alias.count(value) != 0) {
+                        instr.srcs.push_back(value);
+                    }
+                }
+                s.instrs.push_back(instr);
+            }
+        }
+        if (!s.instrs.empty()) {
+            schedules.push_back(s);
+        }
+    }
+    return schedules;
+}
+
+// values read before the function defines them, i.e. handed over by the caller
+std::set<std::string> LiveIn(const Schedule& s)
+{
+    std::set<std::string> defined;
+    std::set<std::string> liveIn;
+    for (const Instr& instr : s.instrs) {
+        for (const std::string& src : instr.srcs) {
+            if (defined.count(src) == 0) {
+                liveIn.insert(src);
+            }
+        }
+        defined.insert(instr.dst);
+    }
+    return liveIn;
+}
+
+// appends the value an accumulating instruction finds in its dst buffer to its sources
+void ResolveAccumulators(Schedule& s)
+{
+    std::map<std::string, std::string> content;
+    for (const std::string& value : LiveIn(s)) {
+        content[s.alias.at(value)] = value;
+    }
+    for (Instr& instr : s.instrs) {
+        const std::string& buf = s.alias.at(instr.dst);
+        if (instr.accumulate) {
+            instr.srcs.push_back(content[buf]);
+        }
+        content[buf] = instr.dst;
+    }
+}
+
+// TMP_BUF_NUM declared in the class body, or inherited from its base
+uint32_t ParseTmpBufNum(const std::string& src, const std::string& cls)
+{
+    std::smatch m;
+    std::regex classRe("class " + cls + R"((?: : public (\w+))?\s*\{)");
+    if (!std::regex_search(src, m, classRe)) {
+        return UINT32_MAX;
+    }
+    std::string base = m[1];
+    size_t begin = m.position() + m.length();
+    std::string decl = src.substr(begin, src.find("\n};", begin) - begin);
+    std::regex numRe(R"(TMP_BUF_NUM = (\d+);)");
+    if (std::regex_search(decl, m, numRe)) {
+        return std::stoul(m[1]);
+    }
+    return base.empty() ? UINT32_MAX : ParseTmpBufNum(src, base);
+}
+
+// vector instructions cls::fn issues, following calls into other *Impl members of cls and its bases
+uint32_t VecInstrNum(const std::string& src, const std::string& cls, const std::string& fn)
+{
+    std::smatch m;
+    std::regex funcRe("inline void " + cls + "::" + fn + R"(\()");
+    if (!std::regex_search(src, m, funcRe)) {
+        std::regex classRe("class " + cls + R"( : public (\w+))");
+        return std::regex_search(src, m, classRe) ? VecInstrNum(src, m[1], fn) : UINT32_MAX;
+    }
+    size_t begin = src.find("\n{", m.position());
+    std::string body = src.substr(begin, src.find("\n}", begin) - begin);
+    const std::regex instrRe(R"(^\s*AscendC::\w+\()");
+    const std::regex callRe(R"(^\s*(\w+Impl)\()");
+    uint32_t num = 0;
+    std::stringstream lines(body);
+    std::string line;
+    while (std::getline(lines, line)) {
+        if (std::regex_search(line, instrRe)) {
+            num++;
+        } else if (std::regex_search(line, m, callRe)) {
+            num += VecInstrNum(src, cls, m[1]);
+        }
+    }
+    return num;
+}
+
+std::set<std::string> LiveOut(const Schedule& s)
+{
+    std::set<std::string> liveOut = {s.instrs.back().dst};
+    auto extra = EXTRA_LIVE_OUT.find(s.cls + "::" + s.fn);
+    if (extra != EXTRA_LIVE_OUT.end()) {
+        liveOut.insert(extra->second.begin(), extra->second.end());
+    }
+    return liveOut;
+}
+
+std::map<std::string, size_t> LastUse(const Schedule& s)
+{
+    std::map<std::string, size_t> lastUse;
+    for (size_t i = 0; i < s.instrs.size(); i++) {
+        for (const std::string& src : s.instrs[i].srcs) {
+            lastUse[src] = i;
+        }
+    }
+    return lastUse;
+}
+
+// peak number of simultaneously live values; an instruction may write over a source it kills
+uint32_t PeakLiveness(const Schedule& s)
+{
+    std::set<std::string> liveOut = LiveOut(s);
+    std::map<std::string, size_t> lastUse = LastUse(s);
+    std::set<std::string> live = LiveIn(s);
+    size_t peak = live.size();
+    for (size_t i = 0; i < s.instrs.size(); i++) {
+        for (const std::string& src : s.instrs[i].srcs) {
+            if (lastUse[src] == i && liveOut.count(src) == 0) {
+                live.erase(src);
+            }
+        }
+        live.insert(s.instrs[i].dst);
+        peak = std::max(peak, live.size());
+    }
+    return peak;
+}
+
+// buffers the function does not own: xLocal, yLocal and any other caller tensor
+uint32_t CallerBufNum(const Schedule& s)
+{
+    std::set<std::string> bufs;
+    for (const auto& entry : s.alias) {
+        if (entry.second.rfind("tmpTensor", 0) != 0) {
+            bufs.insert(entry.second);
+        }
+    }
+    return bufs.size();
+}
+
+const std::string& Source()
+{
+    static const std::string src = ReadStrategySource();
+    return src;
+}
+
+const std::vector<Schedule>& Schedules()
+{
+    static const std::vector<Schedule> schedules = [] {
+        std::vector<Schedule> parsed = ParseSchedules(Source());
+        for (Schedule& s : parsed) {
+            ResolveAccumulators(s);
+        }
+        return parsed;
+    }();
+    return schedules;
+}
+} // namespace
+
+TEST(CosStrategyLiveness, ParsesEveryStrategy)
+{
+    std::set<std::string> classes;
+    for (const Schedule& s : Schedules()) {
+        classes.insert(s.cls);
+    }
+    EXPECT_EQ(classes, (std::set<std::string>{"RefStrategy", "HighPerfStrategy", "HighPrecStrategy",
+                                              "HighPrecShortStrategy", "HighPrecNoReduceStrategy",
+                                              "HighPerfFusedStrategy", "HighPrecFusedStrategy", "HalfStrategy"}));
+}
+
+TEST(CosStrategyLiveness, NoLiveValueIsOverwritten)
+{
+    for (const Schedule& s : Schedules()) {
+        std::map<std::string, std::string> content;
+        for (const std::string& value : LiveIn(s)) {
+            const std::string& buf = s.alias.at(value);
+            ASSERT_EQ(content.count(buf), 0u) << s.cls << "::" << s.fn << ": " << value << " shares " << buf;
+            content[buf] = value;
+        }
+        std::set<std::string> liveOut = LiveOut(s);
+        std::map<std::string, size_t> lastUse = LastUse(s);
+        for (size_t i = 0; i < s.instrs.size(); i++) {
+            const Instr& instr = s.instrs[i];
+            for (const std::string& src : instr.srcs) {
+                ASSERT_EQ(content[s.alias.at(src)], src)
+                    << s.cls << "::" << s.fn << ": " << src << " overwritten before " << instr.dst;
+            }
+            if (instr.accumulate) {
+                const std::string& acc = instr.srcs.back();
+                EXPECT_TRUE(lastUse[acc] == i && liveOut.count(acc) == 0)
+                    << s.cls << "::" << s.fn << ": " << instr.dst << " accumulates onto live " << acc;
+            }
+            content[s.alias.at(instr.dst)] = instr.dst;
+        }
+        for (const std::string& value : LiveOut(s)) {
+            EXPECT_EQ(content[s.alias.at(value)], value) << s.cls << "::" << s.fn << ": " << value << " lost";
+        }
+    }
+}
+
+TEST(CosStrategyLiveness, TmpBufNumMatchesPeakLiveness)
+{
+    std::map<std::string, uint32_t> classPeak;
+    for (const Schedule& s : Schedules()) {
+        uint32_t tmpBufNum = ParseTmpBufNum(Source(), s.cls);
+        ASSERT_NE(tmpBufNum, UINT32_MAX) << s.cls;
+        for (uint32_t idx : s.tmpBufs) {
+            EXPECT_LE(idx, tmpBufNum) << s.cls << "::" << s.fn << " uses tmpBuf" << idx;
+        }
+        uint32_t peak = PeakLiveness(s);
+        uint32_t callerBufNum = CallerBufNum(s);
+        uint32_t needed = (peak > callerBufNum) ? peak - callerBufNum : 0;
+        EXPECT_LE(needed, tmpBufNum) << s.cls << "::" << s.fn;
+        classPeak[s.cls] = std::max(classPeak[s.cls], needed);
+    }
+    // every class that declares its own TMP_BUF_NUM allocates no more than its schedules need
+    for (const char* cls : {"RefStrategy", "HighPerfStrategy", "HighPrecStrategy", "HighPrecNoReduceStrategy",
+                            "HighPerfFusedStrategy", "HalfStrategy"}) {
+        EXPECT_EQ(ParseTmpBufNum(Source(), cls), classPeak[cls]) << cls;
+    }
+}
+
+TEST(CosStrategyLiveness, HostMirrorsKernelTmpBufNum)
+{
+    EXPECT_EQ(ParseTmpBufNum(Source(), "RefStrategy"), COS_TMP_BUF_NUM_REF);
+    EXPECT_EQ(ParseTmpBufNum(Source(), "HighPerfStrategy"), COS_TMP_BUF_NUM_HIGH_PERF);
+    EXPECT_EQ(ParseTmpBufNum(Source(), "HighPrecStrategy"), COS_TMP_BUF_NUM_HIGH_PREC);
+    EXPECT_EQ(ParseTmpBufNum(Source(), "HighPrecShortStrategy"), COS_TMP_BUF_NUM_HIGH_PREC);
+    EXPECT_EQ(ParseTmpBufNum(Source(), "HighPrecNoReduceStrategy"), COS_TMP_BUF_NUM_NO_REDUCE);
+    EXPECT_EQ(ParseTmpBufNum(Source(), "HighPerfFusedStrategy"), COS_TMP_BUF_NUM_HIGH_PERF_FUSED);
+    EXPECT_EQ(ParseTmpBufNum(Source(), "HighPrecFusedStrategy"), COS_TMP_BUF_NUM_HIGH_PREC);
+    EXPECT_EQ(ParseTmpBufNum(Source(), "HalfStrategy"), COS_TMP_BUF_NUM_HALF);
+}
+
+TEST(CosStrategyLiveness, HostMirrorsKernelVecInstrNum)
+{
+    EXPECT_EQ(VecInstrNum(Source(), "RefStrategy", "ComputeImpl"), COS_VEC_INSTR_NUM_REF);
+    EXPECT_EQ(VecInstrNum(Source(), "HighPerfStrategy", "ComputeImpl"), COS_VEC_INSTR_NUM_HIGH_PERF);
+    EXPECT_EQ(VecInstrNum(Source(), "HighPerfFusedStrategy", "ComputeImpl"), COS_VEC_INSTR_NUM_HIGH_PERF_FUSED);
+    EXPECT_EQ(VecInstrNum(Source(), "HighPrecStrategy", "ComputeImpl"), COS_VEC_INSTR_NUM_HIGH_PREC);
+    EXPECT_EQ(VecInstrNum(Source(), "HighPrecFusedStrategy", "ComputeImpl"), COS_VEC_INSTR_NUM_HIGH_PREC_FUSED);
+    EXPECT_EQ(VecInstrNum(Source(), "HighPrecShortStrategy", "ComputeImpl"), COS_VEC_INSTR_NUM_HIGH_PREC_SHORT);
+    EXPECT_EQ(VecInstrNum(Source(), "HighPrecNoReduceStrategy", "ComputeImpl"), COS_VEC_INSTR_NUM_NO_REDUCE);
+    EXPECT_EQ(VecInstrNum(Source(), "HighPrecFusedStrategy", "ComputeSinCosImpl"), COS_VEC_INSTR_NUM_SIN_COS);
+    EXPECT_EQ(VecInstrNum(Source(), "HighPrecFusedStrategy", "ComputeSinImpl"), COS_VEC_INSTR_NUM_SIN);
+    EXPECT_EQ(VecInstrNum(Source(), "HalfStrategy", "ComputeImpl"), COS_VEC_INSTR_NUM_HALF);
+}
+
+TEST(CosStrategyLiveness, ReduceAndSelectAgreeOnHandOver)
+{
+    std::map<std::string, std::set<std::string>> placement;
+    for (const Schedule& s : Schedules()) {
+        for (const char* value : {"n2", "sin_poly_8", "cos_poly_7"}) {
+            if (s.cls.rfind("HighPrec", 0) == 0 && s.cls != "HighPrecNoReduceStrategy" && s.alias.count(value) != 0) {
+                placement[value].insert(s.alias.at(value));
+            }
+        }
+    }
+    for (const auto& entry : placement) {
+        EXPECT_EQ(entry.second.size(), 1u) << entry.first;
+    }
+}
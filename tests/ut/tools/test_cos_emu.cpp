@@ -0,0 +1,791 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * @file test_cos_emu.cpp
+ */
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <random>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "cos_emu.h"
+#include "cos_emu_impl.h"
+#include "cos_tiling_common.h"
+
+namespace {
+constexpr uint32_t CANONICAL_NAN = 0x7FC00000u;
+const cosemu::Isa ALL_ISAS[] = {cosemu::Isa::SCALAR, cosemu::Isa::AVX2, cosemu::Isa::AVX512};
+
+uint32_t FloatBits(float v)
+{
+    uint32_t bits;
+    memcpy(&bits, &v, sizeof(bits));
+    return bits;
+}
+
+float BitsFloat(uint32_t bits)
+{
+    float v;
+    memcpy(&v, &bits, sizeof(v));
+    return v;
+}
+
+std::string ReadStrategySource()
+{
+    std::ifstream file(COS_STRATEGY_PATH);
+    std::stringstream ss;
+    ss << file.rdbuf();
+    return ss.str();
+}
+
+// evaluates the constant expressions of cos_strategy.h with C++ promotion: int < float < double
+class ConstExpr {
+public:
+    struct Num {
+        double v;
+        int rank;
+    };
+
+    explicit ConstExpr(const std::map<std::string, float>& consts) : consts_(consts) {}
+
+    Num Eval(const std::string& expr)
+    {
+        s_ = expr;
+        pos_ = 0;
+        Num n = Sum();
+        Skip();
+        EXPECT_EQ(pos_, s_.size()) << "cannot evaluate " << expr;
+        return n;
+    }
+
+private:
+    void Skip()
+    {
+        while (pos_ < s_.size() && s_[pos_] == ' ') {
+            pos_++;
+        }
+    }
+
+    static Num Apply(char op, Num a, Num b)
+    {
+        int rank = std::max(a.rank, b.rank);
+        if (rank == 1) {
+            float x = static_cast<float>(a.v);
+            float y = static_cast<float>(b.v);
+            float r = (op == '+') ? x + y : (op == '-') ? x - y : (op == '*') ? x * y : x / y;
+            return {r, 1};
+        }
+        if (rank == 0) {
+            int64_t x = static_cast<int64_t>(a.v);
+            int64_t y = static_cast<int64_t>(b.v);
+            int64_t r = (op == '+') ? x + y : (op == '-') ? x - y : (op == '*') ? x * y : x / y;
+            return {static_cast<double>(r), 0};
+        }
+        double r = (op == '+') ? a.v + b.v : (op == '-') ? a.v - b.v : (op == '*') ? a.v * b.v : a.v / b.v;
+        return {r, 2};
+    }
+
+    Num Sum()
+    {
+        Num n = Product();
+        for (Skip(); pos_ < s_.size() && (s_[pos_] == '+' || s_[pos_] == '-'); Skip()) {
+            char op = s_[pos_++];
+            n = Apply(op, n, Product());
+        }
+        return n;
+    }
+
+    Num Product()
+    {
+        Num n = Unary();
+        for (Skip(); pos_ < s_.size() && (s_[pos_] == '*' || s_[pos_] == '/'); Skip()) {
+            char op = s_[pos_++];
+            n = Apply(op, n, Unary());
+        }
+        return n;
+    }
+
+    Num Unary()
+    {
+        Skip();
+        if (s_[pos_] == '-') {
+            pos_++;
+            Num n = Unary();
+            return {-n.v, n.rank};
+        }
+        if (s_[pos_] == '(') {
+            pos_++;
+            Num n = Sum();
+            Skip();
+            pos_++;
+            return n;
+        }
+        std::smatch m;
+        std::string rest = s_.substr(pos_);
+        if (std::regex_search(rest, m, std::regex(R"(^(\d+\.?\d*(?:e[-+]?\d+)?)(f?))"))) {
+            pos_ += m.length();
+            std::string digits = m[1];
+            int rank = (m[2] == "f") ? 1 : (digits.find_first_of(".e") == std::string::npos ? 0 : 2);
+            return {std::stod(digits), rank};
+        }
+        if (std::regex_search(rest, m, std::regex(R"(^\w+)"))) {
+            pos_ += m.length();
+            EXPECT_EQ(consts_.count(m[0]), 1u) << "unknown constant " << m[0];
+            return {consts_.count(m[0]) != 0 ? consts_.at(m[0]) : 0.0f, 1};
+        }
+        ADD_FAILURE() << "cannot parse " << rest;
+        pos_ = s_.size();
+        return {0.0, 0};
+    }
+
+    const std::map<std::string, float>& consts_;
+    std::string s_;
+    size_t pos_ = 0;
+};
+
+// executes the AscendC calls of a strategy, read from the kernel source, on one element per buffer
+class KernelReplay {
+public:
+    explicit KernelReplay(const std::string& src) : src_(src)
+    {
+        const std::regex constRe(R"(\nconstexpr float (\w+) = (.*);)");
+        for (auto it = std::sregex_iterator(src.begin(), src.end(), constRe); it != std::sregex_iterator(); ++it) {
+            consts_[(*it)[1]] = static_cast<float>(ConstExpr(consts_).Eval((*it)[2]).v);
+        }
+    }
+
+    float Run(const std::string& cls, float x)
+    {
+        bufs_.clear();
+        bufs_["xLocal"] = FloatBits(x);
+        Exec(Compile(cls, "ComputeImpl"));
+        return BitsFloat(bufs_["yLocal"]);
+    }
+
+    // strategies on half tensors, e.g. HalfStrategy, with x and y as fp16 bit patterns
+    uint16_t RunHalf(const std::string& cls, uint16_t x)
+    {
+        bufs_.clear();
+        bufs_["xLocal"] = x;
+        Exec(Compile(cls, "ComputeImpl"));
+        return static_cast<uint16_t>(bufs_["yLocal"]);
+    }
+
+    const std::map<std::string, float>& Consts() const { return consts_; }
+
+    // Axpy and MulAddDst (dst += a * b) with one rounding, or two as a Mul then an Add; the device rounding
+    // is not documented, so the fused strategies are checked under both
+    void SetFusedMulAdd(bool fused) { fusedMulAdd_ = fused; }
+
+private:
+    struct Tensor {
+        std::string type;
+        std::string buf;
+    };
+
+    // one AscendC call with its tensors resolved to buffers and its scalar evaluated, or a call into a member
+    struct Instr {
+        std::string op;
+        Tensor dst;
+        Tensor a;
+        Tensor b;
+        float scalar;
+        std::string mode;
+        const std::vector<Instr>* callee;
+    };
+
+    std::string Body(std::string& cls, const std::string& fn)
+    {
+        std::smatch m;
+        if (std::regex_search(src_, m, std::regex("inline void " + cls + "::" + fn + R"(\()"))) {
+            size_t begin = src_.find("\n{", m.position());
+            return src_.substr(begin, src_.find("\n}", begin) - begin);
+        }
+        if (std::regex_search(src_, m, std::regex("class " + cls + R"( : public (\w+))"))) {
+            cls = m[1];
+            return Body(cls, fn);
+        }
+        ADD_FAILURE() << "no " << cls << "::" << fn;
+        return "";
+    }
+
+    const std::vector<Instr>& Compile(std::string cls, const std::string& fn)
+    {
+        std::string key = cls + "::" + fn;
+        auto cached = programs_.find(key);
+        if (cached != programs_.end()) {
+            return cached->second;
+        }
+        std::vector<Instr> program;
+        std::stringstream lines(Body(cls, fn));
+        const std::regex aliasRe(R"(LocalTensor<(\w+)>& (\w+) = (\w+))");
+        const std::regex instrRe(R"(^\s*AscendC::(\w+)\((.*)\);)");
+        const std::regex callRe(R"(^\s*(\w+Impl)\()");
+        std::map<std::string, Tensor> alias;
+        auto resolve = [&alias](const std::string& arg) {
+            // another view of a tensor: name.ReinterpretCast<type>()
+            std::smatch view;
+            std::string name = arg;
+            std::string type;
+            if (std::regex_match(arg, view, std::regex(R"((\w+)\.ReinterpretCast<(\w+)>\(\))"))) {
+                name = view[1];
+                type = view[2];
+            }
+            auto it = alias.find(name);
+            Tensor t = (it != alias.end()) ? it->second : Tensor{"float", name};
+            if (!type.empty()) {
+                t.type = type;
+            }
+            return t;
+        };
+        std::string line;
+        std::smatch m;
+        while (std::getline(lines, line)) {
+            if (std::regex_search(line, m, aliasRe)) {
+                alias[m[2]] = {m[1], m[3]};
+            } else if (std::regex_search(line, m, instrRe)) {
+                std::vector<std::string> args;
+                std::stringstream argStream(m[2]);
+                std::string arg;
+                while (std::getline(argStream, arg, ',')) {
+                    size_t begin = arg.find_first_not_of(' ');
+                    args.push_back(arg.substr(begin, arg.find_last_not_of(' ') - begin + 1));
+                }
+                Instr instr{m[1], resolve(args[0]), {}, {}, 0.0f, "", nullptr};
+                if (instr.op == "Duplicate") {
+                    instr.scalar = Scalar(args[1]);
+                } else if (instr.op == "Cast") {
+                    instr.a = resolve(args[1]);
+                    instr.mode = args[2];
+                } else if (instr.op == "Muls" || instr.op == "Adds" || instr.op == "Mins" || instr.op == "Maxs" ||
+                           instr.op == "ShiftLeft" || instr.op == "Axpy") {
+                    instr.a = resolve(args[1]);
+                    instr.scalar = Scalar(args[2]);
+                } else {
+                    instr.a = resolve(args[1]);
+                    instr.b = resolve(args[2]);
+                }
+                program.push_back(instr);
+            } else if (std::regex_search(line, m, callRe)) {
+                program.push_back({"Call", {}, {}, {}, 0.0f, "", &Compile(cls, m[1])});
+            }
+        }
+        return programs_[key] = program;
+    }
+
+    float Scalar(const std::string& expr)
+    {
+        // static_cast<half>(...) and the like convert the scalar to the tensor type, done when it is applied
+        std::smatch m;
+        if (std::regex_match(expr, m, std::regex(R"(static_cast<\w+>\((.*)\))"))) {
+            return Scalar(m[1]);
+        }
+        return static_cast<float>(ConstExpr(consts_).Eval(expr).v);
+    }
+    float H(const Tensor& t) { return cosemu::detail::HalfToFloat(static_cast<uint16_t>(bufs_[t.buf])); }
+    void SetH(const Tensor& t, float v) { bufs_[t.buf] = cosemu::detail::FloatToHalf(v); }
+    static float HalfScalar(float v) { return cosemu::detail::HalfToFloat(cosemu::detail::FloatToHalf(v)); }
+
+    // one half instruction, computed in fp32 and rounded to half: with 24 >= 2 * 11 + 2 mantissa bits the
+    // double rounding of +, - and * gives the correctly rounded half result
+    bool ExecHalf(const Instr& instr)
+    {
+        const std::string& op = instr.op;
+        if (instr.dst.type == "uint16_t" && op == "ShiftLeft") {
+            bufs_[instr.dst.buf] = static_cast<uint16_t>(bufs_[instr.a.buf] << static_cast<uint32_t>(instr.scalar));
+        } else if (instr.dst.type == "int16_t" && op == "Adds") {
+            int16_t v = static_cast<int16_t>(bufs_[instr.a.buf]);
+            bufs_[instr.dst.buf] = static_cast<uint16_t>(v + static_cast<int16_t>(instr.scalar));
+        } else if (instr.dst.type != "half") {
+            return false;
+        } else if (op == "Muls") {
+            SetH(instr.dst, H(instr.a) * HalfScalar(instr.scalar));
+        } else if (op == "Adds") {
+            SetH(instr.dst, H(instr.a) + HalfScalar(instr.scalar));
+        } else if (op == "Mul") {
+            SetH(instr.dst, H(instr.a) * H(instr.b));
+        } else if (op == "Add") {
+            SetH(instr.dst, H(instr.a) + H(instr.b));
+        } else if (op == "Sub") {
+            SetH(instr.dst, H(instr.a) - H(instr.b));
+        } else {
+            return false;
+        }
+        return true;
+    }
+    float F(const Tensor& t) { return BitsFloat(bufs_[t.buf]); }
+    void SetF(const Tensor& t, float v) { bufs_[t.buf] = FloatBits(v); }
+
+    void Exec(const std::vector<Instr>& program)
+    {
+        for (const Instr& instr : program) {
+            const std::string& op = instr.op;
+            if (op == "Call") {
+                Exec(*instr.callee);
+            } else if (instr.dst.type != "float" && instr.dst.type != "int32_t") {
+                if (!ExecHalf(instr)) {
+                    ADD_FAILURE() << "AscendC::" << op << " on " << instr.dst.type << " is not replayed";
+                }
+            } else if (op == "Duplicate") {
+                SetF(instr.dst, instr.scalar);
+            } else if (op == "Muls") {
+                SetF(instr.dst, F(instr.a) * instr.scalar);
+            } else if (op == "Adds") {
+                SetF(instr.dst, F(instr.a) + instr.scalar);
+            } else if (op == "Mins") {
+                SetF(instr.dst, (F(instr.a) < instr.scalar) ? F(instr.a) : instr.scalar);
+            } else if (op == "Maxs") {
+                SetF(instr.dst, (F(instr.a) > instr.scalar) ? F(instr.a) : instr.scalar);
+            } else if (op == "Mul") {
+                SetF(instr.dst, F(instr.a) * F(instr.b));
+            } else if (op == "Add") {
+                SetF(instr.dst, F(instr.a) + F(instr.b));
+            } else if (op == "Sub") {
+                SetF(instr.dst, F(instr.a) - F(instr.b));
+            } else if (op == "Axpy") {
+                SetF(instr.dst, MulAdd(F(instr.a), instr.scalar, F(instr.dst)));
+            } else if (op == "MulAddDst") {
+                SetF(instr.dst, MulAdd(F(instr.a), F(instr.b), F(instr.dst)));
+            } else if (op == "Cast") {
+                Cast(instr.dst, instr.a, instr.mode);
+            } else {
+                ADD_FAILURE() << "AscendC::" << op << " is not replayed";
+            }
+        }
+    }
+
+    float MulAdd(float a, float b, float c) const
+    {
+        if (fusedMulAdd_) {
+            return std::fma(a, b, c);
+        }
+        return a * b + c;
+    }
+
+    void Cast(const Tensor& dst, const Tensor& src, const std::string& mode)
+    {
+        if (dst.type == "int32_t" && src.type == "float" && mode == "AscendC::RoundMode::CAST_RINT") {
+            float v = F(src);
+            // saturating: 2^31 and above gives INT32_MAX, NaN gives INT32_MIN
+            int32_t r = (v >= 2147483648.0f) ? INT32_MAX :
+                        (!(v >= -2147483648.0f) ? INT32_MIN : static_cast<int32_t>(std::nearbyint(v)));
+            bufs_[dst.buf] = static_cast<uint32_t>(r);
+        } else if (dst.type == "float" && src.type == "int32_t" && mode == "AscendC::RoundMode::CAST_NONE") {
+            SetF(dst, static_cast<float>(static_cast<int32_t>(bufs_[src.buf])));
+        } else if (dst.type == "float" && src.type == "float" && mode == "AscendC::RoundMode::CAST_RINT") {
+            SetF(dst, std::nearbyint(F(src)));
+        } else if (dst.type == "float" && src.type == "float" && mode == "AscendC::RoundMode::CAST_ROUND") {
+            SetF(dst, std::round(F(src)));
+        } else if (dst.type == "float" && src.type == "float" && mode == "AscendC::RoundMode::CAST_FLOOR") {
+            SetF(dst, std::floor(F(src)));
+        } else {
+            ADD_FAILURE() << "Cast " << src.type << " -> " << dst.type << " " << mode << " is not replayed";
+        }
+    }
+
+    const std::string& src_;
+    std::map<std::string, float> consts_;
+    std::map<std::string, std::vector<Instr>> programs_;
+    std::map<std::string, uint32_t> bufs_;
+    bool fusedMulAdd_ = true;
+};
+
+// finite fp32 inputs over every magnitude the reductions treat differently
+std::vector<float> TestInputs()
+{
+    std::vector<float> inputs = {0.0f, -0.0f, 1.0f, -1.0f, 1.5707964f, 3.1415927f, 4.712389f, 6.2831855f,
+                                 8192.0f, 65504.0f, 1.0e6f, 1.0e10f, 3.0e38f, -3.0e38f, 1.0e-40f, -1.0e-30f};
+    std::mt19937 gen(2025);
+    const float bounds[] = {1.0f, 10.0f, 100.0f, 1.0e4f, 1.0e6f};
+    for (float bound : bounds) {
+        std::uniform_real_distribution<float> dist(-bound, bound);
+        for (int i = 0; i < 2000; i++) {
+            inputs.push_back(dist(gen));
+        }
+    }
+    std::uniform_real_distribution<float> exponent(-40.0f, 38.0f);
+    for (int i = 0; i < 2000; i++) {
+        float v = std::pow(10.0f, exponent(gen));
+        inputs.push_back((i % 2 == 0) ? v : -v);
+    }
+    return inputs;
+}
+
+std::vector<uint8_t> RandomBytes(size_t num, cosemu::DataType dtype)
+{
+    std::mt19937 gen(static_cast<uint32_t>(num));
+    std::vector<uint8_t> data;
+    if (dtype == cosemu::DataType::FLOAT32) {
+        std::uniform_real_distribution<float> dist(-1.0e5f, 1.0e5f);
+        std::vector<float> x(num);
+        for (float& v : x) {
+            v = dist(gen);
+        }
+        data.resize(num * sizeof(float));
+        memcpy(data.data(), x.data(), data.size());
+    } else {
+        // every 16-bit pattern, infinities and NaNs included, then random ones
+        std::vector<uint16_t> x(num);
+        for (size_t i = 0; i < num; i++) {
+            x[i] = static_cast<uint16_t>(i < 65536 ? i : gen());
+        }
+        data.resize(num * sizeof(uint16_t));
+        memcpy(data.data(), x.data(), data.size());
+    }
+    return data;
+}
+} // namespace
+
+TEST(CosEmu, MatchesKernelSourceReplay)
+{
+    std::string src = ReadStrategySource();
+    KernelReplay replay(src);
+    const std::pair<const char*, cosemu::Strategy> strategies[] = {
+        {"RefStrategy", cosemu::Strategy::REF},
+        {"HighPerfStrategy", cosemu::Strategy::HIGH_PERF},
+        {"HighPrecStrategy", cosemu::Strategy::HIGH_PREC},
+    };
+    std::vector<float> x = TestInputs();
+    for (const auto& strategy : strategies) {
+        std::vector<uint32_t> expect(x.size());
+        for (size_t i = 0; i < x.size(); i++) {
+            float y = replay.Run(strategy.first, x[i]);
+            expect[i] = std::isnan(y) ? CANONICAL_NAN : FloatBits(y);
+        }
+        for (cosemu::Isa isa : ALL_ISAS) {
+            if (!cosemu::IsaSupported(isa)) {
+                continue;
+            }
+            std::vector<float> y(x.size());
+            cosemu::Cos(strategy.second, cosemu::DataType::FLOAT32, x.data(), y.data(), x.size(), 1, isa);
+            size_t mismatch = 0;
+            for (size_t i = 0; i < x.size(); i++) {
+                if (FloatBits(y[i]) != expect[i] && mismatch++ < 5) {
+                    ADD_FAILURE() << strategy.first << " isa " << static_cast<uint32_t>(isa) << " x " << x[i]
+                                  << ": kernel " << BitsFloat(expect[i]) << ", emulation " << y[i];
+                }
+            }
+            EXPECT_EQ(mismatch, 0u) << strategy.first << " isa " << static_cast<uint32_t>(isa);
+        }
+    }
+}
+
+TEST(CosEmu, ConstantsMatchKernel)
+{
+    using namespace cosemu::detail;
+#define COS_EMU_CONST(name) {#name, name}
+    const std::map<std::string, float> emuConsts = {
+        COS_EMU_CONST(TWO_PI), COS_EMU_CONST(REF_COEF_2), COS_EMU_CONST(REF_COEF_4), COS_EMU_CONST(REF_COEF_6),
+        COS_EMU_CONST(REF_COEF_8), COS_EMU_CONST(REF_COEF_10), COS_EMU_CONST(REF_COEF_12),
+        COS_EMU_CONST(REF_COEF_14), COS_EMU_CONST(PI_FOR_X_TODIV), COS_EMU_CONST(PI_DOWN),
+        COS_EMU_CONST(PI_RESDOWN_ADDS_NEG), COS_EMU_CONST(COS_RES_MULIT_SCA), COS_EMU_CONST(COS_RES_ADDICT_UP),
+        COS_EMU_CONST(COS_2ADDS), COS_EMU_CONST(COS_3ADDS), COS_EMU_CONST(pi_0), COS_EMU_CONST(pi_1),
+        COS_EMU_CONST(pi_2), COS_EMU_CONST(pi_3), COS_EMU_CONST(PI_V4_0), COS_EMU_CONST(PI_V4_1),
+        COS_EMU_CONST(PI_V4_2), COS_EMU_CONST(PI_V4_3), COS_EMU_CONST(PI_12), COS_EMU_CONST(PI_22),
+        COS_EMU_CONST(PI_32), COS_EMU_CONST(PI_42), COS_EMU_CONST(PI_52), COS_EMU_CONST(PI_62),
+        COS_EMU_CONST(INV_HALF_PI), COS_EMU_CONST(SCOEF_4), COS_EMU_CONST(SCOEF_3), COS_EMU_CONST(SCOEF_2),
+        COS_EMU_CONST(SCOEF_1), COS_EMU_CONST(CCOEF_4), COS_EMU_CONST(CCOEF_3), COS_EMU_CONST(CCOEF_2),
+        COS_EMU_CONST(CCOEF_1),
+    };
+#undef COS_EMU_CONST
+    KernelReplay replay(ReadStrategySource());
+    for (const auto& c : emuConsts) {
+        ASSERT_EQ(replay.Consts().count(c.first), 1u) << c.first << " is gone from the kernel";
+        EXPECT_EQ(FloatBits(replay.Consts().at(c.first)), FloatBits(c.second)) << c.first;
+    }
+}
+
+TEST(CosEmu, IsaAndThreadsMatchScalar)
+{
+    const cosemu::Strategy strategies[] = {cosemu::Strategy::REF, cosemu::Strategy::HIGH_PERF,
+                                           cosemu::Strategy::HIGH_PREC};
+    const cosemu::DataType dtypes[] = {cosemu::DataType::FLOAT32, cosemu::DataType::FLOAT16,
+                                       cosemu::DataType::BFLOAT16};
+    // not a multiple of any vector length, so every back end runs its tail
+    const size_t num = 200003;
+    for (cosemu::DataType dtype : dtypes) {
+        std::vector<uint8_t> x = RandomBytes(num, dtype);
+        for (cosemu::Strategy strategy : strategies) {
+            std::vector<uint8_t> expect(x.size());
+            cosemu::Cos(strategy, dtype, x.data(), expect.data(), num, 1, cosemu::Isa::SCALAR);
+            for (cosemu::Isa isa : ALL_ISAS) {
+                if (!cosemu::IsaSupported(isa)) {
+                    continue;
+                }
+                for (uint32_t threadNum : {1u, 3u}) {
+                    std::vector<uint8_t> y(x);
+                    // in place, as cos_golden runs it
+                    cosemu::Cos(strategy, dtype, y.data(), y.data(), num, threadNum, isa);
+                    EXPECT_TRUE(y == expect) << "dtype " << static_cast<uint32_t>(dtype) << " strategy "
+                                             << static_cast<uint32_t>(strategy) << " isa "
+                                             << static_cast<uint32_t>(isa) << " threads " << threadNum;
+                }
+            }
+        }
+    }
+}
+
+TEST(CosEmu, AccuracyWithinStrategyBounds)
+{
+    // max abs error against double cos, fp32 inputs uniform over [-bound, bound]
+    const struct {
+        cosemu::Strategy strategy;
+        float bound;
+        double maxErr;
+    } cases[] = {
+        {cosemu::Strategy::REF, 100.0f, 1.0e-5},
+        {cosemu::Strategy::HIGH_PERF, 1.0e4f, 2.5e-7},
+        {cosemu::Strategy::HIGH_PREC, 1.0e6f, 1.1e-7},
+    };
+    std::mt19937 gen(7);
+    for (const auto& c : cases) {
+        std::uniform_real_distribution<float> dist(-c.bound, c.bound);
+        std::vector<float> x(1 << 20);
+        for (float& v : x) {
+            v = dist(gen);
+        }
+        std::vector<float> y(x.size());
+        cosemu::Cos(c.strategy, cosemu::DataType::FLOAT32, x.data(), y.data(), x.size());
+        double maxErr = 0.0;
+        for (size_t i = 0; i < x.size(); i++) {
+            maxErr = std::max(maxErr, std::fabs(y[i] - std::cos(static_cast<double>(x[i]))));
+        }
+        EXPECT_LE(maxErr, c.maxErr) << "strategy " << static_cast<uint32_t>(c.strategy);
+    }
+
+    // the range-hint strategies of keys 3 and 4 are not emulated: replay them from the kernel source under both
+    // roundings of Axpy and MulAddDst, adding the fp32 neighbours of k * pi / 2 where the reduction cancels
+    const struct {
+        const char* cls;
+        float bound;
+        double maxErr;
+    } replayCases[] = {
+        {"HighPrecShortStrategy", optiling::COS_SHORT_REDUCE_MAX_ABS, 9.0e-8},
+        {"HighPrecNoReduceStrategy", optiling::COS_NO_REDUCE_MAX_ABS, 6.7e-8},
+    };
+    std::string src = ReadStrategySource();
+    KernelReplay replay(src);
+    for (const auto& c : replayCases) {
+        std::uniform_real_distribution<float> dist(-c.bound, c.bound);
+        std::vector<float> x(1 << 17);
+        for (float& v : x) {
+            v = dist(gen);
+        }
+        for (double k = 0.0; k * M_PI_2 <= c.bound + M_PI_2; k += 1.0) {
+            float v = static_cast<float>(k * M_PI_2);
+            for (int step = 0; step < 4; step++) {
+                v = std::nextafter(v, 0.0f);
+            }
+            for (int step = 0; step < 8; step++, v = std::nextafter(v, INFINITY)) {
+                if (std::fabs(v) <= c.bound) {
+                    x.push_back(v);
+                    x.push_back(-v);
+                }
+            }
+        }
+        for (bool fused : {true, false}) {
+            replay.SetFusedMulAdd(fused);
+            double maxErr = 0.0;
+            for (float v : x) {
+                maxErr = std::max(maxErr, std::fabs(replay.Run(c.cls, v) - std::cos(static_cast<double>(v))));
+            }
+            EXPECT_LE(maxErr, c.maxErr) << c.cls << " fused " << fused;
+        }
+    }
+}
+
+TEST(CosEmu, NonFiniteInputsGiveNan)
+{
+    std::vector<float> x = {INFINITY, -INFINITY, NAN, -NAN};
+    for (cosemu::Isa isa : ALL_ISAS) {
+        if (!cosemu::IsaSupported(isa)) {
+            continue;
+        }
+        std::vector<float> y(x.size());
+        cosemu::Cos(cosemu::Strategy::HIGH_PERF, cosemu::DataType::FLOAT32, x.data(), y.data(), x.size(), 1, isa);
+        for (float v : y) {
+            EXPECT_EQ(FloatBits(v), CANONICAL_NAN);
+        }
+    }
+}
+
+TEST(CosEmu, HighPrecIsEvenOver16BitInputs)
+{
+    // HighPrecStrategy gives cos(-x) == cos(x) exactly; the table of tiling key 7 does not rely on it and
+    // holds every pattern, HighPerfStrategy not being even (LutTableRounding)
+    std::vector<uint16_t> x(1 << 16);
+    for (size_t i = 0; i < x.size(); i++) {
+        x[i] = static_cast<uint16_t>(i);
+    }
+    for (cosemu::DataType dtype : {cosemu::DataType::FLOAT16, cosemu::DataType::BFLOAT16}) {
+        std::vector<uint16_t> y(x.size());
+        cosemu::Cos(cosemu::Strategy::HIGH_PREC, dtype, x.data(), y.data(), x.size());
+        for (size_t i = 0; i < 0x8000; i++) {
+            ASSERT_EQ(y[i | 0x8000], y[i]) << "dtype " << static_cast<uint32_t>(dtype) << " x 0x" << std::hex << i;
+        }
+    }
+}
+
+TEST(CosEmu, HalfStrategyWithinTwoFp16Ulp)
+{
+    // every fp16 input HalfStrategy is dispatched for, replayed from the kernel source in half arithmetic
+    std::string src = ReadStrategySource();
+    KernelReplay replay(src);
+    ASSERT_EQ(replay.Consts().count("HALF_MAX_ABS"), 1u);
+    const double maxAbs = replay.Consts().at("HALF_MAX_ABS");
+    double maxUlp = 0.0;
+    double maxErr = 0.0;
+    for (uint32_t bits = 0; bits < 0x10000; bits++) {
+        double x = cosemu::detail::HalfToFloat(static_cast<uint16_t>(bits));
+        if (!(std::fabs(x) <= maxAbs)) {
+            continue;
+        }
+        double y = cosemu::detail::HalfToFloat(replay.RunHalf("HalfStrategy", static_cast<uint16_t>(bits)));
+        double expect = std::cos(x);
+        // fp16 spacing at expect: 2^-24 among the subnormals, 2^(e - 11) in [2^(e - 1), 2^e)
+        int exponent;
+        std::frexp(expect, &exponent);
+        double ulp = std::ldexp(1.0, std::max(exponent, -13) - 11);
+        ASSERT_LE(std::fabs(y), 1.0) << "x " << x;
+        maxUlp = std::max(maxUlp, std::fabs(y - expect) / ulp);
+        maxErr = std::max(maxErr, std::fabs(y - expect));
+    }
+    EXPECT_LT(maxUlp, 2.0);
+    EXPECT_LT(maxErr, 1.0e-3);
+}
+
+TEST(CosEmu, StrategyFromTilingKey)
+{
+    cosemu::Strategy strategy;
+    ASSERT_TRUE(cosemu::StrategyFromTilingKey(5, false, strategy));
+    EXPECT_EQ(strategy, cosemu::Strategy::HIGH_PREC);
+    ASSERT_TRUE(cosemu::StrategyFromTilingKey(6, false, strategy));
+    EXPECT_EQ(strategy, cosemu::Strategy::HIGH_PERF);
+    // the table keys run the strategy of their tens digit
+    ASSERT_TRUE(cosemu::StrategyFromTilingKey(57, false, strategy));
+    EXPECT_EQ(strategy, cosemu::Strategy::HIGH_PREC);
+    ASSERT_TRUE(cosemu::StrategyFromTilingKey(67, false, strategy));
+    EXPECT_EQ(strategy, cosemu::Strategy::HIGH_PERF);
+    // fused and range-hint strategies are not emulated
+    for (uint64_t key : {1u, 2u, 3u, 4u, 17u, 27u, 21u, 301u}) {
+        EXPECT_FALSE(cosemu::StrategyFromTilingKey(key, false, strategy)) << key;
+    }
+    ASSERT_TRUE(cosemu::StrategyFromTilingKey(1, true, strategy));
+    EXPECT_EQ(strategy, cosemu::Strategy::REF);
+}
+
+TEST(CosEmu, LutTableRounding)
+{
+    // the table of tiling keys 17 to 67 holds the strategy result of every 16-bit pattern, replayed here from
+    // the kernel source; count the entries within each strategy's accuracy bound that are not cos(x)
+    // correctly rounded to the 16-bit type, under both roundings of Axpy and MulAddDst
+    struct TableCase {
+        const char* cls;
+        float maxAbs;
+        uint32_t fp16Wrong;
+        uint32_t bf16Wrong;
+    };
+    // fp16 +-0x1.dfp-5: cos(x) lies 2.4e-9 above a rounding midpoint, closer than an fp32 result can tell;
+    // the HighPerf strategies also miss 0x1.2c4p-4 and 0x1.b04p+3
+    const TableCase cases[] = {
+        {"HighPrecFusedStrategy", 1.0e6f, 2, 0},
+        {"HighPerfFusedStrategy", 1.0e4f, 4, 0},
+        {"HighPrecShortStrategy", 8192.0f, 2, 0},
+        {"HighPrecNoReduceStrategy", 0.785398163f, 2, 0},
+        {"HighPrecStrategy", 1.0e6f, 2, 0},
+        {"HighPerfStrategy", 1.0e4f, 4, 0},
+    };
+    std::string src = ReadStrategySource();
+    KernelReplay replay(src);
+    auto toBf16 = [](float v) {
+        uint32_t bits = FloatBits(v);
+        return static_cast<uint16_t>((bits + 0x7FFF + ((bits >> 16) & 1)) >> 16);
+    };
+    for (bool fused : {true, false}) {
+        replay.SetFusedMulAdd(fused);
+        for (const TableCase& c : cases) {
+            for (cosemu::DataType dtype : {cosemu::DataType::FLOAT16, cosemu::DataType::BFLOAT16}) {
+                bool bf16 = (dtype == cosemu::DataType::BFLOAT16);
+                auto widen = [bf16](uint16_t h) {
+                    return bf16 ? BitsFloat(static_cast<uint32_t>(h) << 16) : cosemu::detail::HalfToFloat(h);
+                };
+                auto narrow = [bf16, &toBf16](float v) { return bf16 ? toBf16(v) : cosemu::detail::FloatToHalf(v); };
+                uint32_t wrong = 0;
+                for (uint32_t bits = 0; bits < 0x10000; bits++) {
+                    float x = widen(static_cast<uint16_t>(bits));
+                    if (!(std::fabs(x) <= c.maxAbs)) {
+                        continue;
+                    }
+                    uint16_t y = narrow(replay.Run(c.cls, x));
+                    // the nearest of the three patterns around the double result, ties to even
+                    double expect = std::cos(static_cast<double>(x));
+                    uint16_t best = narrow(static_cast<float>(expect));
+                    for (uint16_t cand : {static_cast<uint16_t>(best - 1), static_cast<uint16_t>(best + 1)}) {
+                        double dc = std::fabs(widen(cand) - expect);
+                        double db = std::fabs(widen(best) - expect);
+                        if (dc < db || (dc == db && (cand & 1) == 0)) {
+                            best = cand;
+                        }
+                    }
+                    wrong += (y != best) ? 1 : 0;
+                }
+                EXPECT_EQ(wrong, bf16 ? c.bf16Wrong : c.fp16Wrong) << c.cls << " fused " << fused;
+            }
+        }
+    }
+}
+
+TEST(CosEmu, FusedKeysMatchEmulationWithinBounds)
+{
+    // the AICPU kernel runs the emulation of keys 5 and 6 where AI core runs keys 1 and 2: Cody-Waite
+    // products n * c are exact within the accuracy bounds, so Axpy rounds the same once or twice
+    struct FusedCase {
+        const char* cls;
+        cosemu::Strategy strategy;
+        float maxAbs;
+    };
+    const FusedCase cases[] = {
+        {"HighPrecFusedStrategy", cosemu::Strategy::HIGH_PREC, 1.0e6f},
+        {"HighPerfFusedStrategy", cosemu::Strategy::HIGH_PERF, 1.0e4f},
+    };
+    std::string src = ReadStrategySource();
+    KernelReplay replay(src);
+    std::vector<float> x = TestInputs();
+    // every finite fp16 and bf16 pattern, widened
+    for (uint32_t bits = 0; bits < 0x10000; bits++) {
+        x.push_back(cosemu::detail::HalfToFloat(static_cast<uint16_t>(bits)));
+        x.push_back(BitsFloat(bits << 16));
+    }
+    for (const FusedCase& c : cases) {
+        std::vector<float> golden(x.size());
+        cosemu::Cos(c.strategy, cosemu::DataType::FLOAT32, x.data(), golden.data(), x.size());
+        for (bool fused : {true, false}) {
+            replay.SetFusedMulAdd(fused);
+            size_t mismatch = 0;
+            for (size_t i = 0; i < x.size(); i++) {
+                if (!(std::fabs(x[i]) <= c.maxAbs)) {
+                    continue;
+                }
+                float y = replay.Run(c.cls, x[i]);
+                if (FloatBits(y) != FloatBits(golden[i]) && mismatch++ < 5) {
+                    ADD_FAILURE() << c.cls << " fused " << fused << " x " << x[i] << ": kernel " << y
+                                  << ", emulation " << golden[i];
+                }
+            }
+            EXPECT_EQ(mismatch, 0u) << c.cls << " fused " << fused;
+        }
+    }
+}
@@ -0,0 +1,226 @@
+#!/usr/bin/python3
+# coding=utf-8
+#
+# Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+# This file is a part of the CANN Open Software.
+# Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+# Please refer to the License for details. You may not use this file except in compliance with the License.
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+# INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+# See LICENSE in the root of the software repository for the full text of the License.
+# ======================================================================================================================
+
+"""
+Offline tiling autotuner of the Cos operator.
+
+Sweeps strategy, core count and tile length per (SoC, dtype, precision_mode, size bucket) and writes the
+fastest configuration of every bucket into op_host/cos_tuned_tiling.h, which TilingFunc includes at build
+time. Buckets without an entry keep the heuristic tiling.
+
+Measurements come either from a recorded cost table (--cost-table, CSV with the columns of COST_FIELDS,
+e.g. collected with msprof) or from a command run once per configuration (--run-cmd), such as a CPU
+simulation (ICPU_RUN_KF) build or an on-device launcher. The command is a format string over the
+COST_FIELDS placeholders except time_us, and must print the elapsed time in microseconds on its last
+line. --record keeps the measurements of a --run-cmd sweep as a cost table for later runs.
+"""
+
+import argparse
+import collections
+import csv
+import json
+import shlex
+import subprocess
+import sys
+
+COST_FIELDS = ["soc", "dtype", "mode", "input_num", "tiling_key", "core_num", "tile_data_num", "time_us"]
+
+# mirrors op_host/cos_tiling_common.h
+BLOCK_SIZE = 32
+GM_BURST_SIZE = 512
+BUFFER_NUM = 2
+QUEUE_NUM = 2
+MODE_KEYS = {"high_precision": 1, "high_performance": 2}
+UNFUSED_KEYS = {1: 5, 2: 6}
+TMP_BUF_NUM = {1: 3, 2: 2, 5: 3, 6: 3}
+TMP_BUF_NUM_REF = 1
+TYPE_LENGTHS = {"float32": 4, "float16": 2, "bfloat16": 2}
+SOCS = {
+    # tuned table id, UB bytes, AI cores, kernel only carries RefStrategy
+    "ascend910b": (1, 192 * 1024, 40, False),
+    "ascend310p": (2, 256 * 1024, 8, True),
+}
+
+
+def ub_tile_num(type_length, tiling_key, ref_only):
+    tmp_buf_num = TMP_BUF_NUM_REF if ref_only else TMP_BUF_NUM[tiling_key]
+    cast_buf_num = 0 if type_length == 4 else QUEUE_NUM
+    return QUEUE_NUM * BUFFER_NUM + (cast_buf_num + tmp_buf_num) * (4 // type_length)
+
+
+def max_tile_data_num(soc, dtype, tiling_key):
+    _, ub_size, _, ref_only = SOCS[soc]
+    type_length = TYPE_LENGTHS[dtype]
+    return (ub_size // BLOCK_SIZE) // ub_tile_num(type_length, tiling_key, ref_only) * (BLOCK_SIZE // type_length)
+
+
+def bucket_sizes(size_log2):
+    """Element counts measured for bucket [2^size_log2, 2^(size_log2 + 1))."""
+    low = 1 << size_log2
+    return sorted({low, low + low // 2, 2 * low - 1})
+
+
+def candidates(soc, dtype, mode, size_log2):
+    """(tiling_key, core_num, tile_data_num) triples valid for every size of the bucket."""
+    _, _, core_num, ref_only = SOCS[soc]
+    mode_key = MODE_KEYS[mode]
+    block_elem_num = BLOCK_SIZE // TYPE_LENGTHS[dtype]
+    burst_elem_num = GM_BURST_SIZE // TYPE_LENGTHS[dtype]
+    block_num = ((1 << size_log2) + block_elem_num - 1) // block_elem_num
+    core_nums = sorted({n for n in [1 << i for i in range(core_num.bit_length())] + [core_num]
+                        if n <= min(core_num, block_num)})
+    keys = [mode_key] if ref_only else [mode_key, UNFUSED_KEYS[mode_key]]
+    for tiling_key in keys:
+        max_tile = max_tile_data_num(soc, dtype, tiling_key)
+        tiles = set()
+        for divisor in (1, 2, 4):
+            tile = max_tile // divisor
+            step = burst_elem_num if tile >= burst_elem_num else block_elem_num
+            tiles.add(tile - tile % step)
+        for core in core_nums:
+            for tile in sorted(tiles):
+                yield tiling_key, core, tile
+
+
+def run_sweep(args):
+    rows = []
+    for soc in args.soc:
+        for dtype in args.dtype:
+            for mode in args.mode:
+                for size_log2 in range(args.min_log2, args.max_log2 + 1):
+                    for tiling_key, core, tile in candidates(soc, dtype, mode, size_log2):
+                        for input_num in bucket_sizes(size_log2):
+                            row = {"soc": soc, "dtype": dtype, "mode": mode, "input_num": input_num,
+                                   "tiling_key": tiling_key, "core_num": core, "tile_data_num": tile}
+                            cmd = args.run_cmd.format(**row)
+                            out = subprocess.run(shlex.split(cmd), check=True, capture_output=True, text=True)
+                            row["time_us"] = float(out.stdout.strip().splitlines()[-1])
+                            rows.append(row)
+    return rows
+
+
+def load_cost_table(path):
+    rows = []
+    with open(path, newline="") as f:
+        for row in csv.DictReader(f):
+            for field in ("input_num", "tiling_key", "core_num", "tile_data_num"):
+                row[field] = int(row[field])
+            row["time_us"] = float(row["time_us"])
+            rows.append(row)
+    return rows
+
+
+def select(rows):
+    """Fastest configuration per (soc, type length, mode, size bucket), scored by the mean time per element."""
+    measured = collections.defaultdict(lambda: collections.defaultdict(dict))
+    for row in rows:
+        if row["soc"] not in SOCS or row["dtype"] not in TYPE_LENGTHS or row["mode"] not in MODE_KEYS:
+            continue
+        if row["input_num"] <= 0:
+            continue
+        # float16 and bfloat16 take the same kernel path and share a table entry
+        bucket = (row["soc"], TYPE_LENGTHS[row["dtype"]], row["mode"], row["input_num"].bit_length() - 1)
+        config = (row["tiling_key"], row["core_num"], row["tile_data_num"])
+        measured[bucket][config][row["input_num"]] = row["time_us"] / row["input_num"]
+    table = []
+    for bucket, configs in sorted(measured.items()):
+        soc, type_length, mode, size_log2 = bucket
+        dtype = "float32" if type_length == 4 else "float16"
+        mode_key = MODE_KEYS[mode]
+        # a bucket is only tuned with configurations measured on every size seen in it
+        sizes = set().union(*(set(times) for times in configs.values()))
+        scored = []
+        for (tiling_key, core, tile), times in configs.items():
+            if set(times) != sizes or tiling_key not in (mode_key, UNFUSED_KEYS[mode_key]):
+                continue
+            if core > SOCS[soc][2] or tile > max_tile_data_num(soc, dtype, tiling_key):
+                continue
+            scored.append((sum(times.values()) / len(times), tiling_key, core, tile))
+        if scored:
+            _, tiling_key, core, tile = min(scored)
+            table.append({"soc": soc, "type_length": type_length, "mode": mode, "size_log2": size_log2,
+                          "tiling_key": tiling_key, "core_num": core, "tile_data_num": tile})
+    return table
+
+
+HEADER_TEMPLATE = """/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * @file cos_tuned_tiling.h
+ * Generated by tools/cos_autotune.py, do not edit. An empty table keeps the heuristic tiling everywhere.
+ */
+#ifndef COS_TUNED_TILING_H
+#define COS_TUNED_TILING_H
+#include <array>
+#include "cos_tiling_common.h"
+
+namespace optiling {{
+// soc, xTypeLength, modeKey, sizeLog2, tilingKey, coreNum, tileDataNum
+constexpr std::array<CosTunedTiling, {num}> COS_TUNED_TILING = {{{{
+{entries}}}}};
+}} // namespace optiling
+#endif // COS_TUNED_TILING_H
+"""
+
+
+def write_header(table, path):
+    entries = "".join(
+        "    {{{}, {}, {}, {}, {}, {}, {}}},\n".format(
+            SOCS[e["soc"]][0], e["type_length"], MODE_KEYS[e["mode"]], e["size_log2"],
+            e["tiling_key"], e["core_num"], e["tile_data_num"])
+        for e in table)
+    with open(path, "w") as f:
+        f.write(HEADER_TEMPLATE.format(num=len(table), entries=entries))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    source = parser.add_mutually_exclusive_group(required=True)
+    source.add_argument("--cost-table", help="recorded measurements, CSV with columns " + ",".join(COST_FIELDS))
+    source.add_argument("--run-cmd", help="command measuring one configuration, e.g. "
+                        "'tests/benchmark/build/cos_cpu_bench_{dtype} --key {tiling_key} --num {input_num} "
+                        "--cores {core_num} --tile {tile_data_num} --time-only'")
+    parser.add_argument("--soc", nargs="+", default=["ascend910b"], choices=sorted(SOCS))
+    parser.add_argument("--dtype", nargs="+", default=sorted(TYPE_LENGTHS), choices=sorted(TYPE_LENGTHS))
+    parser.add_argument("--mode", nargs="+", default=sorted(MODE_KEYS), choices=sorted(MODE_KEYS))
+    parser.add_argument("--min-log2", type=int, default=10)
+    parser.add_argument("--max-log2", type=int, default=24)
+    parser.add_argument("--record", help="write the measurements of a --run-cmd sweep to this CSV")
+    parser.add_argument("--header", default="op_host/cos_tuned_tiling.h")
+    parser.add_argument("--json", help="also write the selected table as JSON")
+    args = parser.parse_args()
+
+    rows = load_cost_table(args.cost_table) if args.cost_table else run_sweep(args)
+    if args.record:
+        with open(args.record, "w", newline="") as f:
+            writer = csv.DictWriter(f, fieldnames=COST_FIELDS)
+            writer.writeheader()
+            writer.writerows(rows)
+    table = select(rows)
+    write_header(table, args.header)
+    if args.json:
+        with open(args.json, "w") as f:
+            json.dump(table, f, indent=2)
+    print("{} measurements, {} tuned buckets written to {}".format(len(rows), len(table), args.header),
+          file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
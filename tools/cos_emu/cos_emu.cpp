@@ -0,0 +1,131 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * @file cos_emu.cpp
+ */
+#include "cos_emu.h"
+#include <algorithm>
+#include <thread>
+#include <vector>
+#include "cos_emu_impl.h"
+#include "cos_tiling_common.h"
+
+namespace cosemu {
+namespace {
+// elements per thread below which another thread costs more than it saves
+constexpr size_t MIN_THREAD_DATA_NUM = 1 << 16;
+// thread slices start on whole 64-byte vectors of every dtype
+constexpr size_t THREAD_ALIGN_NUM = 64;
+
+using Backend = void (*)(Strategy, DataType, const void*, void*, size_t);
+
+Backend SelectBackend(Isa isa)
+{
+    switch (isa) {
+#if COS_EMU_X86
+        case Isa::AVX512:
+            return detail::CosAvx512;
+        case Isa::AVX2:
+            return detail::CosAvx2;
+#endif
+#if COS_EMU_AARCH64
+        case Isa::NEON:
+            return detail::CosNeon;
+#endif
+        default:
+            return detail::CosScalar;
+    }
+}
+} // namespace
+
+bool IsaSupported(Isa isa)
+{
+    switch (isa) {
+#if COS_EMU_X86
+        case Isa::AVX512:
+            return __builtin_cpu_supports("avx512f");
+        case Isa::AVX2:
+            return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("f16c");
+#endif
+#if COS_EMU_AARCH64
+        case Isa::NEON:
+#endif
+        case Isa::SCALAR:
+            return true;
+        default:
+            return false;
+    }
+}
+
+Isa DetectIsa()
+{
+#if COS_EMU_AARCH64
+    static const Isa isa = Isa::NEON;
+#else
+    static const Isa isa = IsaSupported(Isa::AVX512) ? Isa::AVX512 :
+                           (IsaSupported(Isa::AVX2) ? Isa::AVX2 : Isa::SCALAR);
+#endif
+    return isa;
+}
+
+bool StrategyFromTilingKey(uint64_t tilingKey, bool refOnly, Strategy& strategy)
+{
+    if (refOnly) {
+        strategy = Strategy::REF;
+        return true;
+    }
+    switch (tilingKey % optiling::COS_TILING_KEY_STATIC_STEP) {
+        case optiling::COS_TILING_KEY_HIGH_PRECISION_UNFUSED:
+            strategy = Strategy::HIGH_PREC;
+            return true;
+        case optiling::COS_TILING_KEY_HIGH_PERFORMANCE_UNFUSED:
+            strategy = Strategy::HIGH_PERF;
+            return true;
+        case optiling::COS_TILING_KEY_LUT:
+            // the table holds the results of the key in the tens digit
+            return StrategyFromTilingKey(tilingKey / optiling::COS_TILING_KEY_STATIC_STEP, false, strategy);
+        default:
+            return false;
+    }
+}
+
+void Cos(Strategy strategy, DataType dtype, const void* x, void* y, size_t num, uint32_t threadNum)
+{
+    Cos(strategy, dtype, x, y, num, threadNum, DetectIsa());
+}
+
+void Cos(Strategy strategy, DataType dtype, const void* x, void* y, size_t num, uint32_t threadNum, Isa isa)
+{
+    Backend backend = SelectBackend(IsaSupported(isa) ? isa : Isa::SCALAR);
+    if (threadNum == 0) {
+        size_t maxThreadNum = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+        threadNum = static_cast<uint32_t>(std::min(maxThreadNum, std::max<size_t>(num / MIN_THREAD_DATA_NUM, 1)));
+    }
+    size_t sliceNum = (num + threadNum - 1) / threadNum;
+    sliceNum = (sliceNum + THREAD_ALIGN_NUM - 1) / THREAD_ALIGN_NUM * THREAD_ALIGN_NUM;
+    if (threadNum <= 1 || sliceNum >= num) {
+        backend(strategy, dtype, x, y, num);
+        return;
+    }
+    const size_t elemSize = (dtype == DataType::FLOAT32) ? sizeof(float) : sizeof(uint16_t);
+    const uint8_t* src = static_cast<const uint8_t*>(x);
+    uint8_t* dst = static_cast<uint8_t*>(y);
+    std::vector<std::thread> threads;
+    for (size_t offset = sliceNum; offset < num; offset += sliceNum) {
+        size_t len = std::min(sliceNum, num - offset);
+        threads.emplace_back(backend, strategy, dtype, src + offset * elemSize, dst + offset * elemSize, len);
+    }
+    backend(strategy, dtype, x, y, sliceNum);
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+}
+} // namespace cosemu
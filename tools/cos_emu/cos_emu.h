@@ -0,0 +1,62 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * @file cos_emu.h
+ * Host emulation of the Cos kernel strategies, bit-identical to the device for finite inputs.
+ */
+#ifndef COS_EMU_H
+#define COS_EMU_H
+#include <cstddef>
+#include <cstdint>
+
+namespace cosemu {
+// kernel strategies without Axpy/MulAddDst, whose every step is a single IEEE fp32 rounding
+enum class Strategy : uint32_t {
+    REF,        // RefStrategy, the only one on Atlas inference products
+    HIGH_PERF,  // HighPerfStrategy, tiling key 6
+    HIGH_PREC,  // HighPrecStrategy, tiling key 5 and the table of tiling key 57
+};
+
+enum class DataType : uint32_t {
+    FLOAT32,
+    FLOAT16,
+    BFLOAT16,
+};
+
+enum class Isa : uint32_t {
+    SCALAR,
+    AVX2,     // AVX2 + F16C
+    AVX512,   // AVX-512F
+    NEON,     // AArch64 Advanced SIMD
+};
+
+// widest instruction set both compiled in and supported by the running CPU
+Isa DetectIsa();
+bool IsaSupported(Isa isa);
+
+/**
+ * Strategy the kernel runs for tilingKey, false for the fused keys 1 and 2 and the range-hint keys 3 and 4,
+ * which are not emulated, and for the table keys built with them (17 to 47). Within the accuracy bounds keys
+ * 1 and 2 are bit-identical to keys 5 and 6 and only diverge beyond them. Kernels built for Atlas inference
+ * products (refOnly) run RefStrategy for every key.
+ */
+bool StrategyFromTilingKey(uint64_t tilingKey, bool refOnly, Strategy& strategy);
+
+/**
+ * y[i] = cos(x[i]) computed step by step as the kernel does: 16-bit inputs are widened exactly, the strategy
+ * runs in fp32 and the result is rounded to nearest even. x and y may be the same buffer. Inputs that are
+ * not finite give NaN, and every NaN is written as the canonical quiet NaN.
+ * threadNum 0 picks the thread count from num and the hardware concurrency.
+ */
+void Cos(Strategy strategy, DataType dtype, const void* x, void* y, size_t num, uint32_t threadNum = 0);
+void Cos(Strategy strategy, DataType dtype, const void* x, void* y, size_t num, uint32_t threadNum, Isa isa);
+} // namespace cosemu
+#endif // COS_EMU_H
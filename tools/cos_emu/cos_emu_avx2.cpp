@@ -0,0 +1,92 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * @file cos_emu_avx2.cpp
+ * AVX2 + F16C back end, compiled with -mavx2 -mf16c and only called after a CPUID check.
+ */
+#include <immintrin.h>
+#include "cos_emu_impl.h"
+
+namespace cosemu {
+namespace detail {
+namespace {
+struct Avx2Ops {
+    static constexpr size_t LANE = 8;
+    using F = __m256;
+    using I = __m256i;
+
+    static F Set(float v) { return _mm256_set1_ps(v); }
+    static F Add(F a, F b) { return _mm256_add_ps(a, b); }
+    static F Sub(F a, F b) { return _mm256_sub_ps(a, b); }
+    static F Mul(F a, F b) { return _mm256_mul_ps(a, b); }
+    // minps/maxps return the second operand unless the first compares less/greater
+    static F Mins(F a, float s) { return _mm256_min_ps(a, Set(s)); }
+    static F Maxs(F a, float s) { return _mm256_max_ps(a, Set(s)); }
+    static F Rint(F a) { return _mm256_round_ps(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+    static F Floor(F a) { return _mm256_round_ps(a, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC); }
+    static F Round(F a)
+    {
+        // the fraction a - trunc(a) is exact, ties go away from zero
+        F t = _mm256_round_ps(a, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+        F absFrac = _mm256_andnot_ps(Set(-0.0f), Sub(a, t));
+        F one = _mm256_or_ps(Set(1.0f), _mm256_and_ps(a, Set(-0.0f)));
+        return _mm256_blendv_ps(t, Add(t, one), _mm256_cmp_ps(absFrac, Set(0.5f), _CMP_GE_OQ));
+    }
+    static I RintToInt(F a)
+    {
+        // cvtps2dq gives INT32_MIN on overflow and NaN, which only needs fixing for positive overflow
+        I r = _mm256_cvtps_epi32(a);
+        I over = _mm256_castps_si256(_mm256_cmp_ps(a, Set(2147483648.0f), _CMP_GE_OQ));
+        return _mm256_blendv_epi8(r, _mm256_set1_epi32(INT32_MAX), over);
+    }
+    static F IntToFloat(I a) { return _mm256_cvtepi32_ps(a); }
+
+    static F LoadF32(const uint8_t* p) { return _mm256_loadu_ps(reinterpret_cast<const float*>(p)); }
+    static F LoadF16(const uint8_t* p)
+    {
+        return _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+    }
+    static F LoadBf16(const uint8_t* p)
+    {
+        I h = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+        return _mm256_castsi256_ps(_mm256_slli_epi32(h, 16));
+    }
+    static void StoreF32(uint8_t* p, F v) { _mm256_storeu_ps(reinterpret_cast<float*>(p), v); }
+    static void StoreF16(uint8_t* p, F v)
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p), _mm256_cvtps_ph(v, _MM_FROUND_TO_NEAREST_INT));
+    }
+    static void StoreBf16(uint8_t* p, F v)
+    {
+        I bits = _mm256_castps_si256(v);
+        I odd = _mm256_and_si256(_mm256_srli_epi32(bits, 16), _mm256_set1_epi32(1));
+        bits = _mm256_add_epi32(bits, _mm256_add_epi32(odd, _mm256_set1_epi32(0x7FFF)));
+        bits = _mm256_srli_epi32(bits, 16);
+        // packus works within 128-bit lanes, gather the two low quadwords afterwards
+        I packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(bits, bits), 0xD8);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p), _mm256_castsi256_si128(packed));
+    }
+    static F Finish(F x, F y)
+    {
+        F absX = _mm256_andnot_ps(Set(-0.0f), x);
+        F notFinite = _mm256_cmp_ps(absX, Set(__builtin_inff()), _CMP_NLT_UQ);
+        F nan = _mm256_or_ps(notFinite, _mm256_cmp_ps(y, y, _CMP_UNORD_Q));
+        return _mm256_blendv_ps(y, _mm256_castsi256_ps(_mm256_set1_epi32(0x7FC00000)), nan);
+    }
+};
+} // namespace
+
+void CosAvx2(Strategy strategy, DataType dtype, const void* x, void* y, size_t num)
+{
+    CosRun<Avx2Ops>(strategy, dtype, x, y, num);
+}
+} // namespace detail
+} // namespace cosemu
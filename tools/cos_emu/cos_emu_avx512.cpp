@@ -0,0 +1,86 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * @file cos_emu_avx512.cpp
+ * AVX-512F back end, compiled with -mavx512f and only called after a CPUID check.
+ */
+#include <immintrin.h>
+#include "cos_emu_impl.h"
+
+namespace cosemu {
+namespace detail {
+namespace {
+struct Avx512Ops {
+    static constexpr size_t LANE = 16;
+    using F = __m512;
+    using I = __m512i;
+
+    static F Set(float v) { return _mm512_set1_ps(v); }
+    static F Add(F a, F b) { return _mm512_add_ps(a, b); }
+    static F Sub(F a, F b) { return _mm512_sub_ps(a, b); }
+    static F Mul(F a, F b) { return _mm512_mul_ps(a, b); }
+    static F Mins(F a, float s) { return _mm512_min_ps(a, Set(s)); }
+    static F Maxs(F a, float s) { return _mm512_max_ps(a, Set(s)); }
+    static F Rint(F a) { return _mm512_roundscale_ps(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+    static F Floor(F a) { return _mm512_roundscale_ps(a, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC); }
+    static F Round(F a)
+    {
+        F t = _mm512_roundscale_ps(a, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+        F absFrac = _mm512_abs_ps(Sub(a, t));
+        I signBit = _mm512_and_si512(_mm512_castps_si512(a), _mm512_set1_epi32(INT32_MIN));
+        F one = _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(Set(1.0f)), signBit));
+        return _mm512_mask_add_ps(t, _mm512_cmp_ps_mask(absFrac, Set(0.5f), _CMP_GE_OQ), t, one);
+    }
+    static I RintToInt(F a)
+    {
+        I r = _mm512_cvt_roundps_epi32(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        __mmask16 over = _mm512_cmp_ps_mask(a, Set(2147483648.0f), _CMP_GE_OQ);
+        return _mm512_mask_mov_epi32(r, over, _mm512_set1_epi32(INT32_MAX));
+    }
+    static F IntToFloat(I a) { return _mm512_cvtepi32_ps(a); }
+
+    static F LoadF32(const uint8_t* p) { return _mm512_loadu_ps(p); }
+    static F LoadF16(const uint8_t* p)
+    {
+        return _mm512_cvtph_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)));
+    }
+    static F LoadBf16(const uint8_t* p)
+    {
+        I h = _mm512_cvtepu16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)));
+        return _mm512_castsi512_ps(_mm512_slli_epi32(h, 16));
+    }
+    static void StoreF32(uint8_t* p, F v) { _mm512_storeu_ps(p, v); }
+    static void StoreF16(uint8_t* p, F v)
+    {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), _mm512_cvtps_ph(v, _MM_FROUND_TO_NEAREST_INT));
+    }
+    static void StoreBf16(uint8_t* p, F v)
+    {
+        I bits = _mm512_castps_si512(v);
+        I odd = _mm512_and_si512(_mm512_srli_epi32(bits, 16), _mm512_set1_epi32(1));
+        bits = _mm512_add_epi32(bits, _mm512_add_epi32(odd, _mm512_set1_epi32(0x7FFF)));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), _mm512_cvtepi32_epi16(_mm512_srli_epi32(bits, 16)));
+    }
+    static F Finish(F x, F y)
+    {
+        __mmask16 notFinite = _mm512_cmp_ps_mask(_mm512_abs_ps(x), Set(__builtin_inff()), _CMP_NLT_UQ);
+        __mmask16 nan = notFinite | _mm512_cmp_ps_mask(y, y, _CMP_UNORD_Q);
+        return _mm512_mask_mov_ps(y, nan, _mm512_castsi512_ps(_mm512_set1_epi32(0x7FC00000)));
+    }
+};
+} // namespace
+
+void CosAvx512(Strategy strategy, DataType dtype, const void* x, void* y, size_t num)
+{
+    CosRun<Avx512Ops>(strategy, dtype, x, y, num);
+}
+} // namespace detail
+} // namespace cosemu
@@ -0,0 +1,296 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * @file cos_emu_impl.h
+ * Strategy bodies shared by the scalar, AVX2, AVX-512 and NEON back ends. Each back end instantiates them with its
+ * own Ops in an anonymous namespace, so that no inline code compiled for one instruction set is shared with
+ * the others. Ops provides, on LANE floats at a time:
+ *   F / I                        vector of float / int32
+ *   Set, Add, Sub, Mul           IEEE fp32, round to nearest even, never contracted into FMA
+ *   Mins, Maxs                   (a < s) ? a : s and (a > s) ? a : s
+ *   Rint, Round, Floor           CAST_RINT, CAST_ROUND (half away from zero), CAST_FLOOR to float
+ *   RintToInt, IntToFloat        CAST_RINT to int32 saturating (NaN gives INT32_MIN), CAST_NONE back
+ *   Load* / Store*               widen / round to nearest even, Finish(x, y) applies the NaN rules of cos_emu.h
+ */
+#ifndef COS_EMU_IMPL_H
+#define COS_EMU_IMPL_H
+#include <cstdint>
+#include <cstring>
+#include "cos_emu.h"
+
+namespace cosemu {
+namespace detail {
+// constants of op_kernel/cos_strategy.h, replayed against the kernel source by tests/ut/tools/test_cos_emu.cpp
+constexpr float TWO_PI = 2 * 3.14159265358979;
+constexpr float REF_COEF_2 = -1.0 / (2 * 1);
+constexpr float REF_COEF_4 = -1.0 / (4 * 3);
+constexpr float REF_COEF_6 = -1.0 / (6 * 5);
+constexpr float REF_COEF_8 = -1.0 / (8 * 7);
+constexpr float REF_COEF_10 = -1.0 / (10 * 9);
+constexpr float REF_COEF_12 = -1.0 / (12 * 11);
+constexpr float REF_COEF_14 = -1.0 / (14 * 13);
+
+constexpr float PI_FOR_X_TODIV = 0.3183098733425140380859375;
+constexpr float PI_DOWN = 1.57079637050628662109375;
+constexpr float PI_RESDOWN_ADDS_NEG = -0.00000004371139000189375;
+constexpr float COS_RES_MULIT_SCA = 2.604926501e-6;
+constexpr float COS_RES_ADDICT_UP = -0.0001980894471;
+constexpr float COS_2ADDS = 0.008333049340;
+constexpr float COS_3ADDS = -0.1666665792;
+constexpr float pi_0 = 3.14160156;
+constexpr float pi_1 = -8.9071691e-06;
+constexpr float pi_2 = -1.74122761e-09;
+constexpr float pi_3 = 1.24467439e-13;
+
+constexpr float PI_V4_0 = 1.5708008;
+constexpr float PI_V4_1 = -0.0000044535846;
+constexpr float PI_V4_2 = -8.706138e-10;
+constexpr float PI_V4_3 = 1.5703125;
+constexpr float PI_12 = 0.0004837513;
+constexpr float PI_22 = 0.000000075495336;
+constexpr float PI_32 = 2.5579538e-12;
+constexpr float PI_42 = 5.389786e-15;
+constexpr float PI_52 = 5.166901e-19;
+constexpr float PI_62 = 3.281839e-22;
+constexpr float INV_HALF_PI = 0.63661975;
+constexpr float SCOEF_4 = 0.0000027183114939898219064;
+constexpr float SCOEF_3 = -0.000198393348360966317347;
+constexpr float SCOEF_2 = 0.0083333293858894631756;
+constexpr float SCOEF_1 = -0.166666666416265235595;
+constexpr float CCOEF_4 = 0.0000243904487962774090654;
+constexpr float CCOEF_3 = -0.00138867637746099294692;
+constexpr float CCOEF_2 = 0.0416666233237390631894;
+constexpr float CCOEF_1 = -0.499999997251031003120;
+
+// RefStrategy::ComputeImpl, value names follow its aliasing table
+template <class Ops>
+inline typename Ops::F RefCompute(typename Ops::F input_x)
+{
+    using F = typename Ops::F;
+    F vmu_ = Ops::Mul(input_x, Ops::Set(1.0f / TWO_PI));
+    F round_fp32 = Ops::IntToFloat(Ops::RintToInt(vmu_));
+    F t = Ops::Mul(round_fp32, Ops::Set(TWO_PI));
+    F input_x_round = Ops::Sub(input_x, t);
+    F res = Ops::Set(1.0f);
+    F input_x_power = Ops::Mul(input_x_round, input_x_round);
+    F iter_value = Ops::Mul(input_x_power, Ops::Set(REF_COEF_2));
+    res = Ops::Add(res, iter_value);
+    const float coefs[] = {REF_COEF_4, REF_COEF_6, REF_COEF_8, REF_COEF_10, REF_COEF_12, REF_COEF_14};
+    for (float coef : coefs) {
+        F t_i = Ops::Mul(input_x_power, iter_value);
+        iter_value = Ops::Mul(t_i, Ops::Set(coef));
+        res = Ops::Add(res, iter_value);
+    }
+    return res;
+}
+
+// HighPerfStrategy::ComputeImpl
+template <class Ops>
+inline typename Ops::F HighPerfCompute(typename Ops::F input_x)
+{
+    using F = typename Ops::F;
+    F x_vmul = Ops::Mul(input_x, Ops::Set(PI_FOR_X_TODIV));
+    F x_vmul1 = Ops::Add(x_vmul, Ops::Set(0.5f));
+    F x_vmul0 = Ops::Mul(x_vmul, Ops::Set(1.0f / 2048.0f));
+    F round_pi_div = Ops::Round(x_vmul1);
+    F round_pi_div0 = Ops::Round(x_vmul0);
+    F round_pi_div0_1 = Ops::Mul(round_pi_div0, Ops::Set(2048.0f));
+    F round_pi_div1 = Ops::Sub(round_pi_div, round_pi_div0_1);
+
+    F x_fixed = Ops::Sub(input_x, Ops::Mul(round_pi_div0_1, Ops::Set(pi_0)));
+    x_fixed = Ops::Sub(x_fixed, Ops::Mul(round_pi_div1, Ops::Set(pi_0)));
+    x_fixed = Ops::Sub(x_fixed, Ops::Mul(round_pi_div0_1, Ops::Set(pi_1)));
+    x_fixed = Ops::Add(x_fixed, Ops::Set(PI_DOWN));
+    x_fixed = Ops::Sub(x_fixed, Ops::Mul(round_pi_div1, Ops::Set(pi_1)));
+    x_fixed = Ops::Sub(x_fixed, Ops::Mul(round_pi_div0_1, Ops::Set(pi_2)));
+    x_fixed = Ops::Sub(x_fixed, Ops::Mul(round_pi_div1, Ops::Set(pi_2)));
+    x_fixed = Ops::Sub(x_fixed, Ops::Mul(round_pi_div0_1, Ops::Set(pi_3)));
+    x_fixed = Ops::Sub(x_fixed, Ops::Mul(round_pi_div1, Ops::Set(pi_3)));
+    x_fixed = Ops::Add(x_fixed, Ops::Set(PI_RESDOWN_ADDS_NEG));
+
+    F x_pow = Ops::Mul(x_fixed, x_fixed);
+    F kover2 = Ops::Mul(round_pi_div, Ops::Set(0.5f));
+    F kover2floor = Ops::Floor(kover2);
+    F kover2floorm4 = Ops::Mul(kover2floor, Ops::Set(4.0f));
+    F k2 = Ops::Mul(round_pi_div, Ops::Set(-2.0f));
+    F sign = Ops::Add(kover2floorm4, k2);
+    sign = Ops::Add(sign, Ops::Set(1.0f));
+
+    F res_up = Ops::Mul(x_pow, Ops::Set(COS_RES_MULIT_SCA));
+    res_up = Ops::Add(res_up, Ops::Set(COS_RES_ADDICT_UP));
+    res_up = Ops::Mul(res_up, x_pow);
+    res_up = Ops::Add(res_up, Ops::Set(COS_2ADDS));
+    res_up = Ops::Mul(res_up, x_pow);
+    res_up = Ops::Add(res_up, Ops::Set(COS_3ADDS));
+    res_up = Ops::Mul(res_up, x_pow);
+    res_up = Ops::Add(res_up, Ops::Set(1.0f));
+    res_up = Ops::Mul(res_up, x_fixed);
+    F res_sign = Ops::Mul(res_up, sign);
+    return Ops::Maxs(Ops::Mins(res_sign, 1.0f), -1.0f);
+}
+
+// HighPrecStrategy::ReducePolyImpl followed by HighPrecStrategy::CosSelectImpl
+template <class Ops>
+inline typename Ops::F HighPrecCompute(typename Ops::F input_x)
+{
+    using F = typename Ops::F;
+    F x_scaled = Ops::Mul(input_x, Ops::Set(1.0f / 2048.0f));
+    F x_overpi = Ops::Mul(x_scaled, Ops::Set(INV_HALF_PI));
+    F n = Ops::Rint(x_overpi);
+    F n0 = Ops::Mul(x_overpi, Ops::Set(1.0f / 2048.0f));
+    n0 = Ops::Rint(n0);
+    n0 = Ops::Mul(n0, Ops::Set(2048.0f));
+    F n1 = Ops::Sub(n, n0);
+
+    F x_fix = Ops::Sub(x_scaled, Ops::Mul(n0, Ops::Set(PI_V4_0)));
+    x_fix = Ops::Sub(x_fix, Ops::Mul(n1, Ops::Set(PI_V4_0)));
+    x_fix = Ops::Sub(x_fix, Ops::Mul(n0, Ops::Set(PI_V4_1)));
+    x_fix = Ops::Sub(x_fix, Ops::Mul(n1, Ops::Set(PI_V4_1)));
+    x_fix = Ops::Sub(x_fix, Ops::Mul(n0, Ops::Set(PI_V4_2)));
+
+    F remain_x = Ops::Mul(x_fix, Ops::Set(2048.0f));
+    F temp = Ops::Mul(remain_x, Ops::Set(INV_HALF_PI));
+    F n2 = Ops::Rint(temp);
+    n0 = Ops::Mul(n0, Ops::Set(2048.0f));
+    n1 = Ops::Mul(n1, Ops::Set(2048.0f));
+    x_fix = Ops::Sub(input_x, Ops::Mul(n0, Ops::Set(PI_V4_3)));
+    x_fix = Ops::Sub(x_fix, Ops::Mul(n1, Ops::Set(PI_V4_3)));
+    x_fix = Ops::Sub(x_fix, Ops::Mul(n0, Ops::Set(PI_12)));
+
+    // the second stage walks the pi / 2 parts with n2, n1 and n0 one part apart
+    const float parts[] = {PI_V4_3, PI_12, PI_22, PI_32, PI_42, PI_52, PI_62};
+    for (uint32_t i = 0; i + 1 < sizeof(parts) / sizeof(parts[0]); i++) {
+        x_fix = Ops::Sub(x_fix, Ops::Mul(n2, Ops::Set(parts[i])));
+        x_fix = Ops::Sub(x_fix, Ops::Mul(n1, Ops::Set(parts[i + 1])));
+        if (i + 2 < sizeof(parts) / sizeof(parts[0])) {
+            x_fix = Ops::Sub(x_fix, Ops::Mul(n0, Ops::Set(parts[i + 2])));
+        }
+    }
+    x_fix = Ops::Sub(x_fix, Ops::Mul(n2, Ops::Set(PI_62)));
+
+    F x_pow = Ops::Mul(x_fix, x_fix);
+    F sin_poly = Ops::Mul(x_pow, Ops::Set(SCOEF_4));
+    sin_poly = Ops::Add(sin_poly, Ops::Set(SCOEF_3));
+    sin_poly = Ops::Mul(x_pow, sin_poly);
+    sin_poly = Ops::Add(sin_poly, Ops::Set(SCOEF_2));
+    sin_poly = Ops::Mul(x_pow, sin_poly);
+    sin_poly = Ops::Add(sin_poly, Ops::Set(SCOEF_1));
+    sin_poly = Ops::Mul(x_pow, sin_poly);
+    sin_poly = Ops::Add(sin_poly, Ops::Set(1.0f));
+    sin_poly = Ops::Mul(x_fix, sin_poly);
+
+    F cos_poly = Ops::Mul(x_pow, Ops::Set(CCOEF_4));
+    cos_poly = Ops::Add(cos_poly, Ops::Set(CCOEF_3));
+    cos_poly = Ops::Mul(x_pow, cos_poly);
+    cos_poly = Ops::Add(cos_poly, Ops::Set(CCOEF_2));
+    cos_poly = Ops::Mul(x_pow, cos_poly);
+    cos_poly = Ops::Add(cos_poly, Ops::Set(CCOEF_1));
+    cos_poly = Ops::Mul(x_pow, cos_poly);
+    cos_poly = Ops::Add(cos_poly, Ops::Set(1.0f));
+
+    F n2_1 = Ops::Add(n2, Ops::Set(1.0f));
+    F n_half2 = Ops::Floor(Ops::Mul(n2_1, Ops::Set(0.5f)));
+    F n_half4 = Ops::Floor(Ops::Mul(n2_1, Ops::Set(0.25f)));
+    F k1 = Ops::Mul(n_half2, Ops::Set(-2.0f));
+    F k2 = Ops::Mul(n_half4, Ops::Set(4.0f));
+    F sign = Ops::Add(k1, k2);
+    sign = Ops::Add(sign, Ops::Set(1.0f));
+    F ifcos = Ops::Add(n2_1, k1);
+    F ifsin = Ops::Mul(ifcos, Ops::Set(-1.0f));
+    ifsin = Ops::Add(ifsin, Ops::Set(1.0f));
+    F temp1 = Ops::Mul(sin_poly, ifsin);
+    F cos_poly_8 = Ops::Mul(cos_poly, ifcos);
+    F res = Ops::Add(temp1, cos_poly_8);
+    return Ops::Mul(res, sign);
+}
+
+template <class Ops>
+inline typename Ops::F Compute(Strategy strategy, typename Ops::F x)
+{
+    switch (strategy) {
+        case Strategy::HIGH_PERF:
+            return HighPerfCompute<Ops>(x);
+        case Strategy::HIGH_PREC:
+            return HighPrecCompute<Ops>(x);
+        default:
+            return RefCompute<Ops>(x);
+    }
+}
+
+template <class Ops, Strategy STRATEGY>
+inline void ComputeLanes(DataType dtype, const uint8_t* x, uint8_t* y)
+{
+    switch (dtype) {
+        case DataType::FLOAT16: {
+            typename Ops::F xf = Ops::LoadF16(x);
+            Ops::StoreF16(y, Ops::Finish(xf, Compute<Ops>(STRATEGY, xf)));
+            break;
+        }
+        case DataType::BFLOAT16: {
+            typename Ops::F xf = Ops::LoadBf16(x);
+            Ops::StoreBf16(y, Ops::Finish(xf, Compute<Ops>(STRATEGY, xf)));
+            break;
+        }
+        default: {
+            typename Ops::F xf = Ops::LoadF32(x);
+            Ops::StoreF32(y, Ops::Finish(xf, Compute<Ops>(STRATEGY, xf)));
+            break;
+        }
+    }
+}
+
+// the tail runs the same lanes on a zero-padded copy, so every element takes the same instruction sequence
+template <class Ops, Strategy STRATEGY>
+inline void CosLoop(DataType dtype, const void* x, void* y, size_t num)
+{
+    const size_t elemSize = (dtype == DataType::FLOAT32) ? sizeof(float) : sizeof(uint16_t);
+    const uint8_t* src = static_cast<const uint8_t*>(x);
+    uint8_t* dst = static_cast<uint8_t*>(y);
+    size_t i = 0;
+    for (; i + Ops::LANE <= num; i += Ops::LANE) {
+        ComputeLanes<Ops, STRATEGY>(dtype, src + i * elemSize, dst + i * elemSize);
+    }
+    if (i < num) {
+        alignas(64) uint8_t tail[Ops::LANE * sizeof(float)] = {};
+        memcpy(tail, src + i * elemSize, (num - i) * elemSize);
+        ComputeLanes<Ops, STRATEGY>(dtype, tail, tail);
+        memcpy(dst + i * elemSize, tail, (num - i) * elemSize);
+    }
+}
+
+template <class Ops>
+inline void CosRun(Strategy strategy, DataType dtype, const void* x, void* y, size_t num)
+{
+    switch (strategy) {
+        case Strategy::HIGH_PERF:
+            CosLoop<Ops, Strategy::HIGH_PERF>(dtype, x, y, num);
+            break;
+        case Strategy::HIGH_PREC:
+            CosLoop<Ops, Strategy::HIGH_PREC>(dtype, x, y, num);
+            break;
+        default:
+            CosLoop<Ops, Strategy::REF>(dtype, x, y, num);
+            break;
+    }
+}
+
+// exact fp16 widening and round-to-nearest-even narrowing of the scalar back end, also used by the tests
+float HalfToFloat(uint16_t h);
+uint16_t FloatToHalf(float v);
+
+// one back end per instruction set, each in its own translation unit compiled for that instruction set
+void CosScalar(Strategy strategy, DataType dtype, const void* x, void* y, size_t num);
+void CosAvx2(Strategy strategy, DataType dtype, const void* x, void* y, size_t num);
+void CosAvx512(Strategy strategy, DataType dtype, const void* x, void* y, size_t num);
+void CosNeon(Strategy strategy, DataType dtype, const void* x, void* y, size_t num);
+} // namespace detail
+} // namespace cosemu
+#endif // COS_EMU_IMPL_H
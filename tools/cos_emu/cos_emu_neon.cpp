@@ -0,0 +1,79 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * @file cos_emu_neon.cpp
+ * AArch64 NEON back end, used on ARM hosts and by the AICPU kernel in opp_kernel_aicpu. Assumes the default
+ * FPCR: round to nearest even, subnormals kept.
+ */
+#include <arm_neon.h>
+#include "cos_emu_impl.h"
+
+namespace cosemu {
+namespace detail {
+namespace {
+struct NeonOps {
+    static constexpr size_t LANE = 4;
+    using F = float32x4_t;
+    using I = int32x4_t;
+
+    static F Set(float v) { return vdupq_n_f32(v); }
+    static F Add(F a, F b) { return vaddq_f32(a, b); }
+    static F Sub(F a, F b) { return vsubq_f32(a, b); }
+    static F Mul(F a, F b) { return vmulq_f32(a, b); }
+    // fmin/fmax propagate NaN, select instead to keep (a < s) ? a : s of the other back ends
+    static F Mins(F a, float s) { return vbslq_f32(vcltq_f32(a, Set(s)), a, Set(s)); }
+    static F Maxs(F a, float s) { return vbslq_f32(vcgtq_f32(a, Set(s)), a, Set(s)); }
+    static F Rint(F a) { return vrndnq_f32(a); }
+    static F Round(F a) { return vrndaq_f32(a); }
+    static F Floor(F a) { return vrndmq_f32(a); }
+    static I RintToInt(F a)
+    {
+        // fcvtns saturates like the other back ends but gives 0 for NaN
+        return vbslq_s32(vceqq_f32(a, a), vcvtnq_s32_f32(a), vdupq_n_s32(INT32_MIN));
+    }
+    static F IntToFloat(I a) { return vcvtq_f32_s32(a); }
+
+    static F LoadF32(const uint8_t* p) { return vld1q_f32(reinterpret_cast<const float*>(p)); }
+    static F LoadF16(const uint8_t* p) { return vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(Half(p)))); }
+    static F LoadBf16(const uint8_t* p)
+    {
+        return vreinterpretq_f32_u32(vshlq_n_u32(vmovl_u16(vld1_u16(Half(p))), 16));
+    }
+    static void StoreF32(uint8_t* p, F v) { vst1q_f32(reinterpret_cast<float*>(p), v); }
+    static void StoreF16(uint8_t* p, F v)
+    {
+        vst1_u16(reinterpret_cast<uint16_t*>(p), vreinterpret_u16_f16(vcvt_f16_f32(v)));
+    }
+    static void StoreBf16(uint8_t* p, F v)
+    {
+        uint32x4_t bits = vreinterpretq_u32_f32(v);
+        uint32x4_t odd = vandq_u32(vshrq_n_u32(bits, 16), vdupq_n_u32(1));
+        bits = vaddq_u32(bits, vaddq_u32(odd, vdupq_n_u32(0x7FFF)));
+        vst1_u16(reinterpret_cast<uint16_t*>(p), vshrn_n_u32(bits, 16));
+    }
+    static F Finish(F x, F y)
+    {
+        uint32x4_t finite = vcltq_f32(vabsq_f32(x), Set(__builtin_inff()));
+        uint32x4_t keep = vandq_u32(finite, vceqq_f32(y, y));
+        return vbslq_f32(keep, y, vreinterpretq_f32_u32(vdupq_n_u32(0x7FC00000u)));
+    }
+
+private:
+    static const uint16_t* Half(const uint8_t* p) { return reinterpret_cast<const uint16_t*>(p); }
+};
+} // namespace
+
+void CosNeon(Strategy strategy, DataType dtype, const void* x, void* y, size_t num)
+{
+    CosRun<NeonOps>(strategy, dtype, x, y, num);
+}
+} // namespace detail
+} // namespace cosemu
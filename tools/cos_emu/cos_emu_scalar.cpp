@@ -0,0 +1,155 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * @file cos_emu_scalar.cpp
+ * Portable back end, also the reference the SIMD back ends are tested against.
+ */
+#include <cmath>
+#include "cos_emu_impl.h"
+
+namespace cosemu {
+namespace detail {
+namespace {
+uint32_t FloatBits(float v)
+{
+    uint32_t bits;
+    memcpy(&bits, &v, sizeof(bits));
+    return bits;
+}
+
+float BitsFloat(uint32_t bits)
+{
+    float v;
+    memcpy(&v, &bits, sizeof(v));
+    return v;
+}
+
+} // namespace
+
+float HalfToFloat(uint16_t h)
+{
+    uint32_t sign = static_cast<uint32_t>(h & 0x8000u) << 16;
+    uint32_t exp = (h >> 10) & 0x1Fu;
+    uint32_t mant = h & 0x3FFu;
+    if (exp == 0x1Fu) {
+        return BitsFloat(sign | 0x7F800000u | (mant << 13));
+    }
+    if (exp == 0) {
+        // subnormal: mant * 2^-24 is exact in fp32
+        float v = static_cast<float>(mant) * (1.0f / 16777216.0f);
+        return (sign != 0) ? -v : v;
+    }
+    return BitsFloat(sign | ((exp + 112u) << 23) | (mant << 13));
+}
+
+uint16_t FloatToHalf(float v)
+{
+    uint32_t bits = FloatBits(v);
+    uint16_t sign = static_cast<uint16_t>((bits >> 16) & 0x8000u);
+    uint32_t absBits = bits & 0x7FFFFFFFu;
+    if (absBits > 0x7F800000u) {
+        return sign | 0x7E00u;
+    }
+    if (absBits >= 0x477FF000u) {
+        // at or above 65520 rounds to infinity
+        return sign | 0x7C00u;
+    }
+    if (absBits < 0x38800000u) {
+        // below 2^-14 the result is subnormal: adding 0.5 aligns the mantissa to 2^-24 with one rounding
+        float shifted = BitsFloat(absBits) + 0.5f;
+        return sign | static_cast<uint16_t>(FloatBits(shifted) - FloatBits(0.5f));
+    }
+    uint32_t mantOdd = (absBits >> 13) & 1u;
+    absBits += 0xC8000FFFu + mantOdd;  // rebias the exponent by -112 and round the dropped 13 bits to even
+    return sign | static_cast<uint16_t>(absBits >> 13);
+}
+
+namespace {
+float Bf16ToFloat(uint16_t h)
+{
+    return BitsFloat(static_cast<uint32_t>(h) << 16);
+}
+
+uint16_t FloatToBf16(float v)
+{
+    uint32_t bits = FloatBits(v);
+    bits += 0x7FFFu + ((bits >> 16) & 1u);
+    return static_cast<uint16_t>(bits >> 16);
+}
+
+struct ScalarOps {
+    static constexpr size_t LANE = 1;
+    using F = float;
+    using I = int32_t;
+
+    static F Set(float v) { return v; }
+    static F Add(F a, F b) { return a + b; }
+    static F Sub(F a, F b) { return a - b; }
+    static F Mul(F a, F b) { return a * b; }
+    static F Mins(F a, float s) { return (a < s) ? a : s; }
+    static F Maxs(F a, float s) { return (a > s) ? a : s; }
+    static F Rint(F a) { return std::nearbyint(a); }
+    static F Round(F a) { return std::round(a); }
+    static F Floor(F a) { return std::floor(a); }
+    static I RintToInt(F a)
+    {
+        if (!(a < 2147483648.0f)) {
+            return (a != a) ? INT32_MIN : INT32_MAX;
+        }
+        if (a < -2147483648.0f) {
+            return INT32_MIN;
+        }
+        return static_cast<I>(std::nearbyint(a));
+    }
+    static F IntToFloat(I a) { return static_cast<F>(a); }
+
+    static F LoadF32(const uint8_t* p)
+    {
+        F v;
+        memcpy(&v, p, sizeof(v));
+        return v;
+    }
+    static F LoadF16(const uint8_t* p)
+    {
+        uint16_t h;
+        memcpy(&h, p, sizeof(h));
+        return HalfToFloat(h);
+    }
+    static F LoadBf16(const uint8_t* p)
+    {
+        uint16_t h;
+        memcpy(&h, p, sizeof(h));
+        return Bf16ToFloat(h);
+    }
+    static void StoreF32(uint8_t* p, F v) { memcpy(p, &v, sizeof(v)); }
+    static void StoreF16(uint8_t* p, F v)
+    {
+        uint16_t h = FloatToHalf(v);
+        memcpy(p, &h, sizeof(h));
+    }
+    static void StoreBf16(uint8_t* p, F v)
+    {
+        uint16_t h = FloatToBf16(v);
+        memcpy(p, &h, sizeof(h));
+    }
+    static F Finish(F x, F y)
+    {
+        return (std::isfinite(x) && y == y) ? y : BitsFloat(0x7FC00000u);
+    }
+};
+} // namespace
+
+void CosScalar(Strategy strategy, DataType dtype, const void* x, void* y, size_t num)
+{
+    CosRun<ScalarOps>(strategy, dtype, x, y, num);
+}
+} // namespace detail
+} // namespace cosemu
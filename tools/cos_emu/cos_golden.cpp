@@ -0,0 +1,132 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * @file cos_golden.cpp
+ * Writes the device-identical cos of a raw input file, e.g. ./input/input_x.bin of the examples.
+ */
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include "cos_emu.h"
+
+namespace {
+struct GoldenOptions {
+    cosemu::Strategy strategy = cosemu::Strategy::HIGH_PREC;
+    cosemu::DataType dtype = cosemu::DataType::FLOAT32;
+    cosemu::Isa isa = cosemu::DetectIsa();
+    uint32_t threadNum = 0;
+    std::string input;
+    std::string output;
+};
+
+void Usage(const char* prog)
+{
+    fprintf(stderr,
+            "usage: %s --dtype float32|float16|bfloat16 (--strategy ref|high_perf|high_prec | --key TILING_KEY)\n"
+            "          --input X.bin --output Y.bin [--threads N] [--isa scalar|avx2|avx512|neon]\n"
+            "tiling keys 1 and 2 run the fused strategies, bit-identical to keys 5 and 6 within the accuracy\n"
+            "bounds: pass key 5 or 6, or tile with COS_DISABLE=fused_strategy on the device for larger inputs\n",
+            prog);
+}
+
+bool ParseOptions(int argc, char* argv[], GoldenOptions& opts)
+{
+    for (int i = 1; i + 1 < argc; i += 2) {
+        std::string arg = argv[i];
+        std::string value = argv[i + 1];
+        if (arg == "--dtype") {
+            if (value == "float32") {
+                opts.dtype = cosemu::DataType::FLOAT32;
+            } else if (value == "float16") {
+                opts.dtype = cosemu::DataType::FLOAT16;
+            } else if (value == "bfloat16") {
+                opts.dtype = cosemu::DataType::BFLOAT16;
+            } else {
+                return false;
+            }
+        } else if (arg == "--strategy") {
+            if (value == "ref") {
+                opts.strategy = cosemu::Strategy::REF;
+            } else if (value == "high_perf") {
+                opts.strategy = cosemu::Strategy::HIGH_PERF;
+            } else if (value == "high_prec") {
+                opts.strategy = cosemu::Strategy::HIGH_PREC;
+            } else {
+                return false;
+            }
+        } else if (arg == "--key") {
+            if (!cosemu::StrategyFromTilingKey(strtoull(value.c_str(), nullptr, 10), false, opts.strategy)) {
+                return false;
+            }
+        } else if (arg == "--isa") {
+            if (value == "scalar") {
+                opts.isa = cosemu::Isa::SCALAR;
+            } else if (value == "avx2") {
+                opts.isa = cosemu::Isa::AVX2;
+            } else if (value == "avx512") {
+                opts.isa = cosemu::Isa::AVX512;
+            } else if (value == "neon") {
+                opts.isa = cosemu::Isa::NEON;
+            } else {
+                return false;
+            }
+        } else if (arg == "--threads") {
+            opts.threadNum = strtoul(value.c_str(), nullptr, 10);
+        } else if (arg == "--input") {
+            opts.input = value;
+        } else if (arg == "--output") {
+            opts.output = value;
+        } else {
+            return false;
+        }
+    }
+    return (argc % 2 == 1) && !opts.input.empty() && !opts.output.empty() && cosemu::IsaSupported(opts.isa);
+}
+} // namespace
+
+int32_t main(int32_t argc, char* argv[])
+{
+    GoldenOptions opts;
+    if (!ParseOptions(argc, argv, opts)) {
+        Usage(argv[0]);
+        return 1;
+    }
+    std::ifstream in(opts.input, std::ios::binary);
+    if (!in.is_open()) {
+        fprintf(stderr, "failed to open %s\n", opts.input.c_str());
+        return 1;
+    }
+    std::vector<char> data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    const size_t elemSize = (opts.dtype == cosemu::DataType::FLOAT32) ? sizeof(float) : sizeof(uint16_t);
+    if (data.size() % elemSize != 0) {
+        fprintf(stderr, "%s: %zu bytes is not a whole number of elements\n", opts.input.c_str(), data.size());
+        return 1;
+    }
+    size_t num = data.size() / elemSize;
+    auto begin = std::chrono::steady_clock::now();
+    cosemu::Cos(opts.strategy, opts.dtype, data.data(), data.data(), num, opts.threadNum, opts.isa);
+    auto end = std::chrono::steady_clock::now();
+    std::ofstream out(opts.output, std::ios::binary);
+    out.write(data.data(), static_cast<std::streamsize>(data.size()));
+    if (!out.good()) {
+        fprintf(stderr, "failed to write %s\n", opts.output.c_str());
+        return 1;
+    }
+    double us = std::chrono::duration<double, std::micro>(end - begin).count();
+    fprintf(stderr, "%zu elements in %.1f us (%.1f Melem/s)\n", num, us, num / std::max(us, 1e-3));
+    return 0;
+}
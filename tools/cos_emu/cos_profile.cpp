@@ -0,0 +1,475 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2025. All rights reserved.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * @file cos_profile.cpp
+ * Sweeps every fp16/bf16 input, and every fp32 input or a per-binade sample of them, through the emulated
+ * strategies and reports their ULP error against double precision cos next to their cost per element.
+ */
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <thread>
+#include <vector>
+#include "cos_emu.h"
+#include "cos_tiling_common.h"
+
+namespace {
+constexpr size_t CHUNK_DATA_NUM = 1 << 20;
+// |x| below 2^MIN_BINADE share the first magnitude bin; cos(x) rounds to 1 there in every dtype
+constexpr int32_t MIN_BINADE = -30;
+constexpr int32_t MAX_BINADE = 127;
+constexpr size_t BIN_NUM = MAX_BINADE - MIN_BINADE + 1;
+// upper edges of the ULP error histogram, the last bucket takes everything above
+constexpr std::array<double, 8> ULP_BUCKET_EDGES = {0.5, 1.0, 2.0, 4.0, 16.0, 256.0, 65536.0,
+                                                    std::numeric_limits<double>::infinity()};
+constexpr uint32_t FP32_EXP_NUM = 255;
+
+struct StrategyInfo {
+    cosemu::Strategy strategy;
+    const char* name;
+    uint64_t tilingKey;
+    bool refOnly;
+};
+
+constexpr StrategyInfo STRATEGIES[] = {
+    {cosemu::Strategy::REF, "ref", optiling::COS_TILING_KEY_HIGH_PRECISION, true},
+    {cosemu::Strategy::HIGH_PERF, "high_perf", optiling::COS_TILING_KEY_HIGH_PERFORMANCE_UNFUSED, false},
+    {cosemu::Strategy::HIGH_PREC, "high_prec", optiling::COS_TILING_KEY_HIGH_PRECISION_UNFUSED, false},
+};
+constexpr size_t STRATEGY_NUM = sizeof(STRATEGIES) / sizeof(STRATEGIES[0]);
+
+struct ProfileOptions {
+    cosemu::DataType dtype = cosemu::DataType::FLOAT16;
+    const char* dtypeName = "float16";
+    std::vector<size_t> strategies;
+    double ulpBound = 1.0;
+    // fp32 mantissas sampled per binade and sign, 0 sweeps all 2^32 bit patterns
+    uint64_t fp32Samples = 1 << 14;
+    uint32_t threadNum = 0;
+    std::string json;
+};
+
+struct UlpStats {
+    uint64_t num = 0;
+    // inf and NaN results of finite inputs: counted above the bound and in the last bucket, left out of max and mean
+    uint64_t nonFiniteNum = 0;
+    double sumUlp = 0.0;
+    double maxUlp = 0.0;
+    double maxUlpInput = 0.0;
+    // smallest |x| whose error exceeds the bound
+    double minBadAbs = std::numeric_limits<double>::infinity();
+    std::array<uint64_t, ULP_BUCKET_EDGES.size()> buckets{};
+
+    void Add(double x, double ulp, double bound)
+    {
+        num++;
+        if (!std::isfinite(ulp)) {
+            nonFiniteNum++;
+            minBadAbs = std::min(minBadAbs, std::fabs(x));
+            buckets.back()++;
+            return;
+        }
+        sumUlp += ulp;
+        if (ulp > maxUlp) {
+            maxUlp = ulp;
+            maxUlpInput = x;
+        }
+        if (ulp > bound) {
+            minBadAbs = std::min(minBadAbs, std::fabs(x));
+        }
+        size_t bucket = 0;
+        while (ulp > ULP_BUCKET_EDGES[bucket]) {
+            bucket++;
+        }
+        buckets[bucket]++;
+    }
+
+    double MeanUlp() const
+    {
+        return (num > nonFiniteNum) ? sumUlp / (num - nonFiniteNum) : 0.0;
+    }
+
+    void Merge(const UlpStats& other)
+    {
+        num += other.num;
+        nonFiniteNum += other.nonFiniteNum;
+        sumUlp += other.sumUlp;
+        if (other.maxUlp > maxUlp) {
+            maxUlp = other.maxUlp;
+            maxUlpInput = other.maxUlpInput;
+        }
+        minBadAbs = std::min(minBadAbs, other.minBadAbs);
+        for (size_t i = 0; i < buckets.size(); i++) {
+            buckets[i] += other.buckets[i];
+        }
+    }
+};
+
+struct StrategyReport {
+    UlpStats total;
+    std::vector<UlpStats> bins = std::vector<UlpStats>(BIN_NUM);
+    double seconds = 0.0;
+    // largest swept |x| below minBadAbs: every swept input up to it stays within the bound
+    double maxGoodAbs = 0.0;
+};
+
+uint32_t MantissaBits(cosemu::DataType dtype)
+{
+    return (dtype == cosemu::DataType::FLOAT32) ? 23 : ((dtype == cosemu::DataType::FLOAT16) ? 10 : 7);
+}
+
+int32_t MinNormalExp(cosemu::DataType dtype)
+{
+    return (dtype == cosemu::DataType::FLOAT16) ? -14 : -126;
+}
+
+// spacing of the output dtype at ref: the unit a correctly rounded result is off by at most half of
+double Ulp(double ref, cosemu::DataType dtype)
+{
+    int32_t exp = MinNormalExp(dtype);
+    if (ref != 0.0) {
+        int32_t frexpExp;
+        std::frexp(ref, &frexpExp);
+        exp = std::max(frexpExp - 1, exp);
+    }
+    return std::ldexp(1.0, exp - static_cast<int32_t>(MantissaBits(dtype)));
+}
+
+double HalfToDouble(uint16_t h)
+{
+    uint32_t exp = (h >> 10) & 0x1F;
+    uint32_t man = h & 0x3FF;
+    double value = (exp == 0) ? std::ldexp(man, -24) :
+                   (exp == 0x1F) ? ((man == 0) ? std::numeric_limits<double>::infinity() :
+                                                 std::numeric_limits<double>::quiet_NaN()) :
+                                   std::ldexp(man | 0x400, static_cast<int32_t>(exp) - 25);
+    return (h & 0x8000) ? -value : value;
+}
+
+double BitsToDouble(uint32_t bits, cosemu::DataType dtype)
+{
+    if (dtype == cosemu::DataType::FLOAT16) {
+        return HalfToDouble(static_cast<uint16_t>(bits));
+    }
+    if (dtype == cosemu::DataType::BFLOAT16) {
+        bits <<= 16;
+    }
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+uint64_t InputNum(const ProfileOptions& opts)
+{
+    if (opts.dtype != cosemu::DataType::FLOAT32) {
+        return 1ULL << 16;
+    }
+    return (opts.fp32Samples == 0) ? (1ULL << 32) : 2 * FP32_EXP_NUM * opts.fp32Samples;
+}
+
+// bit pattern of the index-th swept input; the fp32 sample spreads its mantissas evenly over each binade
+uint32_t InputBits(uint64_t index, const ProfileOptions& opts)
+{
+    if (opts.dtype != cosemu::DataType::FLOAT32 || opts.fp32Samples == 0 || opts.fp32Samples >= (1ULL << 23)) {
+        return static_cast<uint32_t>(index);
+    }
+    uint64_t sign = index / (FP32_EXP_NUM * opts.fp32Samples);
+    uint64_t exp = index / opts.fp32Samples % FP32_EXP_NUM;
+    uint64_t sample = index % opts.fp32Samples;
+    uint64_t man = (opts.fp32Samples == 1) ? 0 : sample * 0x7FFFFF / (opts.fp32Samples - 1);
+    return static_cast<uint32_t>((sign << 31) | (exp << 23) | man);
+}
+
+size_t BinIndex(double x)
+{
+    if (x == 0.0) {
+        return 0;
+    }
+    int32_t frexpExp;
+    std::frexp(x, &frexpExp);
+    return static_cast<size_t>(std::max(frexpExp - 1, MIN_BINADE) - MIN_BINADE);
+}
+
+void Usage(const char* prog)
+{
+    fprintf(stderr,
+            "usage: %s [--dtype float16|bfloat16|float32] [--strategy ref|high_perf|high_prec]...\n"
+            "          [--ulp-bound B] [--fp32-samples S] [--threads N] [--json FILE]\n"
+            "fp16 and bf16 sweep all 65536 inputs; fp32 samples S mantissas per binade and sign (default 16384),\n"
+            "--fp32-samples 0 sweeps all 2^32 inputs\n",
+            prog);
+}
+
+bool ParseOptions(int argc, char* argv[], ProfileOptions& opts)
+{
+    for (int i = 1; i + 1 < argc; i += 2) {
+        std::string arg = argv[i];
+        std::string value = argv[i + 1];
+        if (arg == "--dtype") {
+            if (value == "float32") {
+                opts.dtype = cosemu::DataType::FLOAT32;
+            } else if (value == "float16") {
+                opts.dtype = cosemu::DataType::FLOAT16;
+            } else if (value == "bfloat16") {
+                opts.dtype = cosemu::DataType::BFLOAT16;
+            } else {
+                return false;
+            }
+            opts.dtypeName = argv[i + 1];
+        } else if (arg == "--strategy") {
+            size_t index = 0;
+            while (index < STRATEGY_NUM && value != STRATEGIES[index].name) {
+                index++;
+            }
+            if (index == STRATEGY_NUM) {
+                return false;
+            }
+            opts.strategies.push_back(index);
+        } else if (arg == "--ulp-bound") {
+            opts.ulpBound = strtod(value.c_str(), nullptr);
+        } else if (arg == "--fp32-samples") {
+            opts.fp32Samples = strtoull(value.c_str(), nullptr, 10);
+        } else if (arg == "--threads") {
+            opts.threadNum = strtoul(value.c_str(), nullptr, 10);
+        } else if (arg == "--json") {
+            opts.json = value;
+        } else {
+            return false;
+        }
+    }
+    if (opts.strategies.empty()) {
+        for (size_t i = 0; i < STRATEGY_NUM; i++) {
+            opts.strategies.push_back(i);
+        }
+    }
+    return argc % 2 == 1 && opts.ulpBound >= 0.0;
+}
+
+// runs fn(begin, end) on threadNum slices of [0, num) and waits for all of them
+template <typename Fn>
+void ParallelSlices(size_t num, uint32_t threadNum, Fn fn)
+{
+    size_t sliceNum = (num + threadNum - 1) / threadNum;
+    std::vector<std::thread> threads;
+    for (size_t begin = sliceNum; begin < num; begin += sliceNum) {
+        threads.emplace_back(fn, begin, std::min(begin + sliceNum, num));
+    }
+    fn(0, std::min(sliceNum, num));
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+}
+
+void Profile(const ProfileOptions& opts, std::vector<StrategyReport>& reports)
+{
+    const uint64_t inputNum = InputNum(opts);
+    const size_t elemSize = (opts.dtype == cosemu::DataType::FLOAT32) ? sizeof(float) : sizeof(uint16_t);
+    const uint32_t threadNum = (opts.threadNum != 0) ? opts.threadNum :
+                               std::max<uint32_t>(std::thread::hardware_concurrency(), 1);
+    std::vector<uint8_t> x(CHUNK_DATA_NUM * elemSize);
+    std::vector<uint8_t> y(CHUNK_DATA_NUM * elemSize);
+    std::vector<double> xValue(CHUNK_DATA_NUM);
+    std::vector<double> ref(CHUNK_DATA_NUM);
+    std::vector<StrategyReport> sliceReports(threadNum);
+
+    for (uint64_t offset = 0; offset < inputNum; offset += CHUNK_DATA_NUM) {
+        size_t num = static_cast<size_t>(std::min<uint64_t>(CHUNK_DATA_NUM, inputNum - offset));
+        ParallelSlices(num, threadNum, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                uint32_t bits = InputBits(offset + i, opts);
+                memcpy(x.data() + i * elemSize, &bits, elemSize);
+                xValue[i] = BitsToDouble(bits, opts.dtype);
+                ref[i] = std::cos(xValue[i]);
+            }
+        });
+        for (size_t s = 0; s < opts.strategies.size(); s++) {
+            auto start = std::chrono::steady_clock::now();
+            cosemu::Cos(STRATEGIES[opts.strategies[s]].strategy, opts.dtype, x.data(), y.data(), num, threadNum);
+            reports[s].seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+            size_t sliceNum = (num + threadNum - 1) / threadNum;
+            ParallelSlices(num, threadNum, [&](size_t begin, size_t end) {
+                StrategyReport& local = sliceReports[begin / sliceNum];
+                for (size_t i = begin; i < end; i++) {
+                    // inf and NaN inputs have no cos to compare against
+                    if (!std::isfinite(xValue[i])) {
+                        continue;
+                    }
+                    uint32_t bits = 0;
+                    memcpy(&bits, y.data() + i * elemSize, elemSize);
+                    double ulp = std::fabs(BitsToDouble(bits, opts.dtype) - ref[i]) / Ulp(ref[i], opts.dtype);
+                    local.total.Add(xValue[i], ulp, opts.ulpBound);
+                    local.bins[BinIndex(xValue[i])].Add(xValue[i], ulp, opts.ulpBound);
+                }
+            });
+            for (StrategyReport& local : sliceReports) {
+                reports[s].total.Merge(local.total);
+                for (size_t bin = 0; bin < BIN_NUM; bin++) {
+                    reports[s].bins[bin].Merge(local.bins[bin]);
+                }
+                local = StrategyReport();
+            }
+        }
+    }
+
+    // the bound holds up to the last swept magnitude below the first one that breaks it
+    for (uint64_t index = 0; index < inputNum; index++) {
+        double absX = std::fabs(BitsToDouble(InputBits(index, opts), opts.dtype));
+        if (!std::isfinite(absX)) {
+            continue;
+        }
+        for (StrategyReport& report : reports) {
+            if (absX < report.total.minBadAbs) {
+                report.maxGoodAbs = std::max(report.maxGoodAbs, absX);
+            }
+        }
+    }
+}
+
+// vector cycles per element of a full AI core tile, from the cost model of op_host/cos_tiling_common.h
+double ModelCyclesPerElem(const StrategyInfo& info, cosemu::DataType dtype)
+{
+    uint32_t xTypeLength = (dtype == cosemu::DataType::FLOAT32) ? sizeof(float) : sizeof(uint16_t);
+    optiling::CosCostInfo cost = {optiling::CosStrategyVecInstrNum(info.tilingKey, info.refOnly), 2,
+                                  optiling::COS_BUFFER_NUM};
+    optiling::CosTileCycles cycles =
+        optiling::CosEstimateTile(optiling::COS_STATIC_TILE_DATA_NUM, xTypeLength, true, 1, cost);
+    return static_cast<double>(cycles.vec) / optiling::COS_STATIC_TILE_DATA_NUM;
+}
+
+std::string BinName(size_t bin)
+{
+    int32_t binade = static_cast<int32_t>(bin) + MIN_BINADE;
+    if (binade == MIN_BINADE) {
+        return "<2^" + std::to_string(MIN_BINADE + 1);
+    }
+    return "2^" + std::to_string(binade);
+}
+
+void PrintReport(const ProfileOptions& opts, const std::vector<StrategyReport>& reports)
+{
+    printf("dtype %s, %lu inputs, ULP of the output dtype against double precision cos, bound %.3g ULP\n\n",
+           opts.dtypeName, static_cast<unsigned long>(reports[0].total.num), opts.ulpBound);
+    printf("%-12s %12s %12s %14s %10s %14s %12s %12s\n", "strategy", "max_ulp", "mean_ulp", "max_ulp_at",
+           "non_finite", "max_abs_in_bnd", "host_ns/elem", "model_cyc/el");
+    for (size_t s = 0; s < opts.strategies.size(); s++) {
+        const StrategyInfo& info = STRATEGIES[opts.strategies[s]];
+        const StrategyReport& report = reports[s];
+        printf("%-12s %12.4g %12.4g %14.7g %10lu %14.7g %12.3f %12.3f\n", info.name, report.total.maxUlp,
+               report.total.MeanUlp(), report.total.maxUlpInput,
+               static_cast<unsigned long>(report.total.nonFiniteNum), report.maxGoodAbs,
+               report.seconds * 1e9 / std::max<uint64_t>(report.total.num, 1), ModelCyclesPerElem(info, opts.dtype));
+    }
+
+    printf("\nmax / mean ULP by |x|\n%-10s", "|x| >=");
+    for (size_t strategy : opts.strategies) {
+        printf(" %23s", STRATEGIES[strategy].name);
+    }
+    printf("\n");
+    for (size_t bin = 0; bin < BIN_NUM; bin++) {
+        if (reports[0].bins[bin].num == 0) {
+            continue;
+        }
+        printf("%-10s", BinName(bin).c_str());
+        for (const StrategyReport& report : reports) {
+            const UlpStats& stats = report.bins[bin];
+            printf(" %11.4g / %9.3g", stats.maxUlp, stats.MeanUlp());
+        }
+        printf("\n");
+    }
+
+    printf("\nULP error histogram\n%-10s", "ulp <=");
+    for (size_t strategy : opts.strategies) {
+        printf(" %14s", STRATEGIES[strategy].name);
+    }
+    printf("\n");
+    for (size_t bucket = 0; bucket < ULP_BUCKET_EDGES.size(); bucket++) {
+        printf("%-10g", ULP_BUCKET_EDGES[bucket]);
+        for (const StrategyReport& report : reports) {
+            printf(" %14lu", static_cast<unsigned long>(report.total.buckets[bucket]));
+        }
+        printf("\n");
+    }
+}
+
+void WriteBuckets(FILE* file, const UlpStats& stats)
+{
+    fprintf(file, "[");
+    for (size_t bucket = 0; bucket < stats.buckets.size(); bucket++) {
+        fprintf(file, "%s%lu", (bucket == 0) ? "" : ", ", static_cast<unsigned long>(stats.buckets[bucket]));
+    }
+    fprintf(file, "]");
+}
+
+bool WriteJson(const ProfileOptions& opts, const std::vector<StrategyReport>& reports)
+{
+    FILE* file = fopen(opts.json.c_str(), "w");
+    if (file == nullptr) {
+        fprintf(stderr, "failed to open %s\n", opts.json.c_str());
+        return false;
+    }
+    for (size_t s = 0; s < opts.strategies.size(); s++) {
+        const StrategyInfo& info = STRATEGIES[opts.strategies[s]];
+        const StrategyReport& report = reports[s];
+        uint64_t num = std::max<uint64_t>(report.total.num, 1);
+        fprintf(file,
+                "{\"dtype\": \"%s\", \"strategy\": \"%s\", \"input_num\": %lu, \"non_finite_num\": %lu, "
+                "\"max_ulp\": %.6g, \"mean_ulp\": %.6g, \"max_ulp_input\": %.9g, \"ulp_bound\": %.6g, "
+                "\"max_abs_within_bound\": %.9g, \"host_ns_per_elem\": %.4f, \"model_cycles_per_elem\": %.4f, "
+                "\"ulp_histogram\": ",
+                opts.dtypeName, info.name, static_cast<unsigned long>(report.total.num),
+                static_cast<unsigned long>(report.total.nonFiniteNum), report.total.maxUlp,
+                report.total.MeanUlp(), report.total.maxUlpInput, opts.ulpBound, report.maxGoodAbs,
+                report.seconds * 1e9 / num, ModelCyclesPerElem(info, opts.dtype));
+        WriteBuckets(file, report.total);
+        fprintf(file, ", \"bins\": [");
+        bool first = true;
+        for (size_t bin = 0; bin < BIN_NUM; bin++) {
+            const UlpStats& stats = report.bins[bin];
+            if (stats.num == 0) {
+                continue;
+            }
+            fprintf(file, "%s{\"binade\": %d, \"input_num\": %lu, \"non_finite_num\": %lu, \"max_ulp\": %.6g, "
+                    "\"mean_ulp\": %.6g, \"ulp_histogram\": ", first ? "" : ", ",
+                    static_cast<int32_t>(bin) + MIN_BINADE, static_cast<unsigned long>(stats.num),
+                    static_cast<unsigned long>(stats.nonFiniteNum), stats.maxUlp, stats.MeanUlp());
+            WriteBuckets(file, stats);
+            fprintf(file, "}");
+            first = false;
+        }
+        fprintf(file, "]}\n");
+    }
+    return fclose(file) == 0;
+}
+} // namespace
+
+int32_t main(int32_t argc, char* argv[])
+{
+    ProfileOptions opts;
+    if (!ParseOptions(argc, argv, opts)) {
+        Usage(argv[0]);
+        return 1;
+    }
+    std::vector<StrategyReport> reports(opts.strategies.size());
+    Profile(opts, reports);
+    PrintReport(opts, reports);
+    if (!opts.json.empty() && !WriteJson(opts, reports)) {
+        return 1;
+    }
+    return 0;
+}